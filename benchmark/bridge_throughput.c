@@ -0,0 +1,304 @@
+/**
+ * @file:      bridge_throughput.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include <linvoke.h>
+
+/**
+ * @def EVENT_COUNT
+ * @brief The number of events sent by the throughput benchmarks
+ */
+#define EVENT_COUNT 1000000
+
+/**
+ * @def ROUND_TRIP_COUNT
+ * @brief The number of request and response pairs sent by the latency benchmarks
+ */
+#define ROUND_TRIP_COUNT 100000
+
+/**
+ * @def BRIDGE_SIZE
+ * @brief The size of the ring buffer of each bridge in bytes
+ */
+#define BRIDGE_SIZE (1 << 20)
+
+/**
+ * @def REQUEST_SIGNAL
+ * @brief The signal that carries events from the parent process to the child process
+ */
+#define REQUEST_SIGNAL 1
+
+/**
+ * @def RESPONSE_SIGNAL
+ * @brief The signal that carries events from the child process back to the parent process
+ */
+#define RESPONSE_SIGNAL 2
+
+/**
+ * @struct message_s
+ * @brief The payload of every event, sized like a typical small message
+ */
+typedef struct message_s
+{
+    uint64_t sequence;
+    uint8_t padding[56];
+} message_s;
+
+/**
+ * @brief Returns the current time of the monotonic clock in seconds
+ */
+static double now(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Compares two durations for qsort
+ */
+static int compare_durations(const void *first, const void *second)
+{
+    const double a = *(const double *) first;
+    const double b = *(const double *) second;
+    return (a > b) - (a < b);
+}
+
+/**
+ * @brief Prints the median and the 99th percentile of a set of round trip times
+ */
+static void print_round_trips(const char *name, double *durations)
+{
+    qsort(durations, ROUND_TRIP_COUNT, sizeof(*durations), compare_durations);
+    printf("%s round trip x %u: median %.2f us, p99 %.2f us\n", name, ROUND_TRIP_COUNT, durations[ROUND_TRIP_COUNT / 2] * 1e6, durations[ROUND_TRIP_COUNT * 99 / 100] * 1e6);
+}
+
+/**
+ * @brief Slot that counts the received events in the counter given as the context
+ */
+static void count_slot(linvoke_event_s *event)
+{
+    uint32_t *counter = linvoke_event_get_context(event);
+    ++*counter;
+}
+
+/**
+ * @brief Slot of the child process that answers every request with a response carrying the same message
+ */
+static void echo_slot(linvoke_event_s *event)
+{
+    linvoke_emit(linvoke_event_get_context(event), RESPONSE_SIGNAL, linvoke_event_get_user_data(event));
+}
+
+/**
+ * @brief Streams events through a bridge to a child process
+ */
+static void benchmark_bridge_throughput(void)
+{
+    linvoke_bridge_s *bridge = linvoke_bridge_create(BRIDGE_SIZE);
+    const double start = now();
+    const pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        linvoke_s *receiver = linvoke_create();
+        uint32_t received_event_count = 0;
+        linvoke_register_signal(receiver, REQUEST_SIGNAL);
+        linvoke_connect_with_context(receiver, REQUEST_SIGNAL, count_slot, &received_event_count);
+
+        while (received_event_count < EVENT_COUNT)
+        {
+            linvoke_bridge_wait(bridge, -1);
+            linvoke_bridge_dispatch(bridge, receiver);
+        }
+
+        _exit(0);
+    }
+
+    linvoke_s *sender = linvoke_create();
+    linvoke_register_signal(sender, REQUEST_SIGNAL);
+    linvoke_bridge_forward(sender, REQUEST_SIGNAL, bridge, sizeof(message_s));
+
+    message_s message = { 0 };
+
+    for (uint32_t i = 0; i < EVENT_COUNT; ++i)
+    {
+        message.sequence = i;
+        linvoke_emit(sender, REQUEST_SIGNAL, &message);
+    }
+
+    waitpid(pid, NULL, 0);
+    const double duration = now() - start;
+
+    printf("bridge x %u: %.3f ms, %.2f M events/s\n", EVENT_COUNT, duration * 1e3, EVENT_COUNT / duration / 1e6);
+
+    linvoke_destroy(sender);
+    linvoke_bridge_destroy(bridge);
+}
+
+/**
+ * @brief Streams the same messages through a socketpair to a child process
+ */
+static void benchmark_socketpair_throughput(void)
+{
+    int sockets[2];
+    socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets);
+
+    const double start = now();
+    const pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        message_s message;
+
+        for (uint32_t i = 0; i < EVENT_COUNT; ++i)
+        {
+            read(sockets[1], &message, sizeof(message));
+        }
+
+        _exit(0);
+    }
+
+    message_s message = { 0 };
+
+    for (uint32_t i = 0; i < EVENT_COUNT; ++i)
+    {
+        message.sequence = i;
+        write(sockets[0], &message, sizeof(message));
+    }
+
+    waitpid(pid, NULL, 0);
+    const double duration = now() - start;
+
+    printf("socketpair x %u: %.3f ms, %.2f M events/s\n", EVENT_COUNT, duration * 1e3, EVENT_COUNT / duration / 1e6);
+
+    close(sockets[0]);
+    close(sockets[1]);
+}
+
+/**
+ * @brief Sends requests through one bridge and waits for each response on another one
+ */
+static void benchmark_bridge_latency(void)
+{
+    linvoke_bridge_s *request_bridge = linvoke_bridge_create(BRIDGE_SIZE);
+    linvoke_bridge_s *response_bridge = linvoke_bridge_create(BRIDGE_SIZE);
+    const pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        linvoke_s *child = linvoke_create();
+        linvoke_register_signal(child, REQUEST_SIGNAL);
+        linvoke_register_signal(child, RESPONSE_SIGNAL);
+        linvoke_connect_with_context(child, REQUEST_SIGNAL, echo_slot, child);
+        linvoke_bridge_forward(child, RESPONSE_SIGNAL, response_bridge, sizeof(message_s));
+
+        for (uint32_t i = 0; i < ROUND_TRIP_COUNT;)
+        {
+            linvoke_bridge_wait(request_bridge, -1);
+            i += linvoke_bridge_dispatch(request_bridge, child);
+        }
+
+        _exit(0);
+    }
+
+    linvoke_s *parent = linvoke_create();
+    uint32_t response_count = 0;
+    linvoke_register_signal(parent, REQUEST_SIGNAL);
+    linvoke_register_signal(parent, RESPONSE_SIGNAL);
+    linvoke_bridge_forward(parent, REQUEST_SIGNAL, request_bridge, sizeof(message_s));
+    linvoke_connect_with_context(parent, RESPONSE_SIGNAL, count_slot, &response_count);
+
+    double *durations = malloc(ROUND_TRIP_COUNT * sizeof(*durations));
+    message_s message = { 0 };
+
+    for (uint32_t i = 0; i < ROUND_TRIP_COUNT; ++i)
+    {
+        const double start = now();
+        message.sequence = i;
+        linvoke_emit(parent, REQUEST_SIGNAL, &message);
+
+        while (response_count == i)
+        {
+            linvoke_bridge_wait(response_bridge, -1);
+            linvoke_bridge_dispatch(response_bridge, parent);
+        }
+
+        durations[i] = now() - start;
+    }
+
+    waitpid(pid, NULL, 0);
+    print_round_trips("bridge", durations);
+
+    free(durations);
+    linvoke_destroy(parent);
+    linvoke_bridge_destroy(response_bridge);
+    linvoke_bridge_destroy(request_bridge);
+}
+
+/**
+ * @brief Sends requests through a socketpair and waits for each response on the same socketpair
+ */
+static void benchmark_socketpair_latency(void)
+{
+    int sockets[2];
+    socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets);
+
+    const pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        message_s message;
+
+        for (uint32_t i = 0; i < ROUND_TRIP_COUNT; ++i)
+        {
+            read(sockets[1], &message, sizeof(message));
+            write(sockets[1], &message, sizeof(message));
+        }
+
+        _exit(0);
+    }
+
+    double *durations = malloc(ROUND_TRIP_COUNT * sizeof(*durations));
+    message_s message = { 0 };
+
+    for (uint32_t i = 0; i < ROUND_TRIP_COUNT; ++i)
+    {
+        const double start = now();
+        message.sequence = i;
+        write(sockets[0], &message, sizeof(message));
+        read(sockets[0], &message, sizeof(message));
+        durations[i] = now() - start;
+    }
+
+    waitpid(pid, NULL, 0);
+    print_round_trips("socketpair", durations);
+
+    free(durations);
+    close(sockets[0]);
+    close(sockets[1]);
+}
+
+int main(void)
+{
+    benchmark_bridge_throughput();
+    benchmark_socketpair_throughput();
+    benchmark_bridge_latency();
+    benchmark_socketpair_latency();
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file:      coro_resume.cpp
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include <linvoke_coro.hpp>
+
+/**
+ * @def EMIT_COUNT
+ * @brief The number of events emitted by each benchmark
+ */
+#define EMIT_COUNT 1000000
+
+/**
+ * @brief Returns the current time of the monotonic clock in seconds
+ */
+static double now(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Slot that adds the emitted value to the sum given as its context
+ */
+static void sum_slot(linvoke_event_s *event)
+{
+    *static_cast<uint64_t *>(linvoke_event_get_context(event)) += *static_cast<uint64_t *>(linvoke_event_get_user_data(event));
+}
+
+/**
+ * @brief Coroutine that does the same as sum_slot, waiting for every event with co_await
+ */
+static linvoke::task sum_events(linvoke::signal_waiters &waiters, uint64_t &sum)
+{
+    for (;;)
+    {
+        const linvoke::event event = co_await linvoke::next(waiters);
+        sum += *static_cast<uint64_t *>(event.user_data);
+    }
+}
+
+int main(void)
+{
+    linvoke_s *linvoke = linvoke_create();
+    const linvoke_signal callback_signal_id = 1;
+    const linvoke_signal inline_signal_id = 2;
+    const linvoke_signal queued_signal_id = 3;
+    linvoke_register_signal(linvoke, callback_signal_id);
+    linvoke_register_signal(linvoke, inline_signal_id);
+    linvoke_register_signal(linvoke, queued_signal_id);
+
+    {
+        uint64_t callback_sum = 0;
+        uint64_t inline_sum = 0;
+        uint64_t queued_sum = 0;
+
+        linvoke::queued_executor executor;
+        linvoke::signal_waiters inline_waiters(linvoke, inline_signal_id);
+        linvoke::signal_waiters queued_waiters(linvoke, queued_signal_id, &executor);
+
+        linvoke_connect_with_context(linvoke, callback_signal_id, sum_slot, &callback_sum);
+        const linvoke::task inline_task = sum_events(inline_waiters, inline_sum);
+        const linvoke::task queued_task = sum_events(queued_waiters, queued_sum);
+
+        // The slot is called directly
+        double start = now();
+
+        for (uint64_t i = 0; i < EMIT_COUNT; ++i)
+        {
+            linvoke_emit(linvoke, callback_signal_id, &i);
+        }
+
+        printf("Callback slot x %u: %.2f ns per event\n", EMIT_COUNT, (now() - start) * 1e9 / EMIT_COUNT);
+
+        // The coroutine is resumed inside linvoke_emit and parks itself again before it returns
+        start = now();
+
+        for (uint64_t i = 0; i < EMIT_COUNT; ++i)
+        {
+            linvoke_emit(linvoke, inline_signal_id, &i);
+        }
+
+        printf("Coroutine resumed inline x %u: %.2f ns per event\n", EMIT_COUNT, (now() - start) * 1e9 / EMIT_COUNT);
+
+        // The coroutine is queued by linvoke_emit and resumed by the executor
+        start = now();
+
+        for (uint64_t i = 0; i < EMIT_COUNT; ++i)
+        {
+            linvoke_emit(linvoke, queued_signal_id, &i);
+            executor.run();
+        }
+
+        printf("Coroutine resumed by a queued executor x %u: %.2f ns per event\n", EMIT_COUNT, (now() - start) * 1e9 / EMIT_COUNT);
+
+        // Every variant has to see every event, otherwise the numbers are meaningless
+        if (inline_sum != callback_sum || queued_sum != callback_sum)
+        {
+            fprintf(stderr, "The coroutines missed events.\n");
+            return 1;
+        }
+
+        linvoke_disconnect_with_context(linvoke, callback_signal_id, sum_slot, &callback_sum);
+    }
+
+    linvoke_destroy(linvoke);
+
+    return 0;
+}
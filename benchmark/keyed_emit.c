@@ -0,0 +1,99 @@
+/**
+ * @file:      keyed_emit.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include <linvoke.h>
+
+/**
+ * @def KEY_COUNT
+ * @brief The number of keys, each of which has one interested slot
+ */
+#define KEY_COUNT 10000
+
+/**
+ * @def EMIT_COUNT
+ * @brief The number of events emitted by each benchmark
+ */
+#define EMIT_COUNT 100000
+
+/**
+ * @brief Returns the current time of the monotonic clock in seconds
+ */
+static double now(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Slot that is connected with its key as the context and returns right away if the key of the event is another one
+ */
+static void filtering_slot(linvoke_event_s *event)
+{
+    const uint64_t *const key = linvoke_event_get_user_data(event);
+
+    if (*key != (uint64_t) (uintptr_t) linvoke_event_get_context(event))
+    {
+        return;
+    }
+}
+
+/**
+ * @brief Slot that is only called for its key, so it does not have to check it
+ */
+static void keyed_slot(linvoke_event_s *event)
+{
+    (void) event; // Unused
+}
+
+int main(void)
+{
+    linvoke_s *linvoke = linvoke_create();
+    const linvoke_signal filtered_signal_id = 1;
+    const linvoke_signal keyed_signal_id = 2;
+    linvoke_register_signal(linvoke, filtered_signal_id);
+    linvoke_register_signal(linvoke, keyed_signal_id);
+
+    for (uint64_t key = 0; key < KEY_COUNT; ++key)
+    {
+        linvoke_connect_with_context(linvoke, filtered_signal_id, filtering_slot, (void *) (uintptr_t) key);
+        linvoke_connect_keyed(linvoke, keyed_signal_id, key, keyed_slot);
+    }
+
+    // Every slot is called and compares the key
+    double start = now();
+
+    for (uint64_t i = 0; i < EMIT_COUNT; ++i)
+    {
+        uint64_t key = i % KEY_COUNT;
+        linvoke_emit(linvoke, filtered_signal_id, &key);
+    }
+
+    printf("linvoke_emit with %u filtering slots x %u: %.2f ns per event\n", KEY_COUNT, EMIT_COUNT, (now() - start) * 1e9 / EMIT_COUNT);
+
+    // Only the slot of the key is called
+    start = now();
+
+    for (uint64_t i = 0; i < EMIT_COUNT; ++i)
+    {
+        uint64_t key = i % KEY_COUNT;
+        linvoke_emit_keyed(linvoke, keyed_signal_id, key, &key);
+    }
+
+    printf("linvoke_emit_keyed with %u keyed slots x %u: %.2f ns per event\n", KEY_COUNT, EMIT_COUNT, (now() - start) * 1e9 / EMIT_COUNT);
+
+    linvoke_destroy(linvoke);
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file:      named_emit.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include <linvoke.h>
+
+/**
+ * @def EMIT_COUNT
+ * @brief The number of events emitted by each benchmark
+ */
+#define EMIT_COUNT 10000000
+
+/**
+ * @def SIGNAL_COUNT
+ * @brief The number of named signals, so the names do not all land in the same cache lines
+ */
+#define SIGNAL_COUNT 1000
+
+/**
+ * @brief Returns the current time of the monotonic clock in seconds
+ */
+static double now(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Slot that does nothing, so only the dispatch overhead is measured
+ */
+static void slot(linvoke_event_s *event)
+{
+    (void) event; // Unused
+}
+
+int main(void)
+{
+    linvoke_s *linvoke = linvoke_create();
+    char name[32];
+
+    for (uint32_t i = 0; i < SIGNAL_COUNT; ++i)
+    {
+        snprintf(name, sizeof(name), "plugin.signal.%u", i);
+        linvoke_connect(linvoke, linvoke_register_named(linvoke, name), slot);
+    }
+
+    const linvoke_signal signal_id = linvoke_find_named(linvoke, "plugin.signal.500");
+
+    // Emit by integer ID
+    double start = now();
+
+    for (uint32_t i = 0; i < EMIT_COUNT; ++i)
+    {
+        linvoke_emit(linvoke, signal_id, NULL);
+    }
+
+    printf("linvoke_emit x %u: %.2f ns per event\n", EMIT_COUNT, (now() - start) * 1e9 / EMIT_COUNT);
+
+    // Emit by name through a cached named signal
+    static linvoke_named_signal_s named_signal = LINVOKE_NAMED_SIGNAL("plugin.signal.500");
+    start = now();
+
+    for (uint32_t i = 0; i < EMIT_COUNT; ++i)
+    {
+        linvoke_emit_named(linvoke, &named_signal, NULL);
+    }
+
+    printf("linvoke_emit_named x %u: %.2f ns per event\n", EMIT_COUNT, (now() - start) * 1e9 / EMIT_COUNT);
+
+    // Emit by name, looking the name up every time
+    start = now();
+
+    for (uint32_t i = 0; i < EMIT_COUNT; ++i)
+    {
+        linvoke_emit(linvoke, linvoke_find_named(linvoke, "plugin.signal.500"), NULL);
+    }
+
+    printf("linvoke_find_named + linvoke_emit x %u: %.2f ns per event\n", EMIT_COUNT, (now() - start) * 1e9 / EMIT_COUNT);
+
+    linvoke_destroy(linvoke);
+
+    return 0;
+}
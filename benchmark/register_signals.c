@@ -0,0 +1,102 @@
+/**
+ * @file:      register_signals.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <linvoke.h>
+
+/**
+ * @def SIGNAL_COUNT
+ * @brief The number of signals registered by each benchmark
+ */
+#define SIGNAL_COUNT 100000
+
+/**
+ * @brief Returns the current time of the monotonic clock in seconds
+ */
+static double now(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Slot that does nothing, so only the dispatch overhead is measured
+ */
+static void slot(linvoke_event_s *event)
+{
+    (void) event; // Unused
+}
+
+int main(void)
+{
+    linvoke_signal *signal_ids = malloc(SIGNAL_COUNT * sizeof(*signal_ids));
+
+    if (signal_ids == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the signal IDs.\n");
+        return 1;
+    }
+
+    // Spread the IDs, so they do not map to consecutive entries of the signal index
+    for (uint32_t i = 0; i < SIGNAL_COUNT; ++i)
+    {
+        signal_ids[i] = i * 2654435761u;
+    }
+
+    // Register the signals one by one
+    linvoke_s *linvoke = linvoke_create();
+    double start = now();
+
+    for (uint32_t i = 0; i < SIGNAL_COUNT; ++i)
+    {
+        linvoke_register_signal(linvoke, signal_ids[i]);
+    }
+
+    printf("linvoke_register_signal x %u: %.3f ms\n", SIGNAL_COUNT, (now() - start) * 1e3);
+    linvoke_destroy(linvoke);
+
+    // Register the signals with a single call
+    linvoke = linvoke_create();
+    start = now();
+
+    linvoke_register_signals(linvoke, signal_ids, SIGNAL_COUNT);
+
+    printf("linvoke_register_signals (%u signals): %.3f ms\n", SIGNAL_COUNT, (now() - start) * 1e3);
+
+    // Connect a slot to every signal
+    start = now();
+
+    for (uint32_t i = 0; i < SIGNAL_COUNT; ++i)
+    {
+        linvoke_connect(linvoke, signal_ids[i], slot);
+    }
+
+    printf("linvoke_connect x %u: %.3f ms\n", SIGNAL_COUNT, (now() - start) * 1e3);
+
+    // Emit an event from every signal, which measures the signal lookup
+    start = now();
+
+    for (uint32_t i = 0; i < SIGNAL_COUNT; ++i)
+    {
+        linvoke_emit(linvoke, signal_ids[i], NULL);
+    }
+
+    printf("linvoke_emit x %u: %.3f ms\n", SIGNAL_COUNT, (now() - start) * 1e3);
+
+    linvoke_destroy(linvoke);
+    free(signal_ids);
+
+    return 0;
+}
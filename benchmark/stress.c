@@ -0,0 +1,456 @@
+/**
+ * @file:      stress.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include <getopt.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <linvoke.h>
+
+/**
+ * @def LATENCY_SAMPLE_INTERVAL
+ * @brief Only every n-th event of a producer is timed, so reading the clock does not dominate the run
+ */
+#define LATENCY_SAMPLE_INTERVAL 16
+
+/**
+ * @struct options_s
+ * @brief The shape of the workload, set from the command line
+ * @var producer_count The number of threads that post events
+ * @var consumer_count The number of threads that dispatch events, each one owning a linvoke object
+ * @var signal_count The number of signals of every linvoke object
+ * @var slots_per_signal The number of slots connected to every signal
+ * @var events_per_producer The number of events posted by every producer
+ * @var mixed Whether the consumers connect, disconnect and emit between the dispatches as well
+ */
+typedef struct options_s
+{
+    uint32_t producer_count;
+    uint32_t consumer_count;
+    uint32_t signal_count;
+    uint32_t slots_per_signal;
+    uint32_t events_per_producer;
+    bool mixed;
+} options_s;
+
+/**
+ * @struct message_s
+ * @brief The payload of every posted event
+ * @var producer The index of the producer that posted the event
+ * @var sequence The number of events the producer posted to the same consumer before this one
+ * @var post_time The time at which the event was posted in nanoseconds, or 0 if the event is not timed
+ */
+typedef struct message_s
+{
+    uint32_t producer;
+    uint32_t sequence;
+    uint64_t post_time;
+} message_s;
+
+/**
+ * @struct consumer_s
+ * @brief A thread that dispatches the events posted to its linvoke object and checks them
+ * @var linvoke The linvoke object, which only this thread emits and dispatches on
+ * @var thread The thread
+ * @var expected_sequences The next sequence expected from every producer
+ * @var received_event_count The number of events checked by the first slot of the signals
+ * @var slot_call_count The number of calls of the first slots of the signals
+ * @var slot_call_counts The number of calls of the other slots, one counter for every slot of a signal after the first
+ * @var lost_event_count The number of events that were skipped in the sequence of a producer
+ * @var duplicated_event_count The number of events that arrived again or out of order
+ * @var latencies The sampled times from posting to dispatching in nanoseconds
+ * @var latency_count The number of sampled times
+ * @var latency_capacity The length of the latencies array
+ * @var churn_emit_count The number of events emitted to the churn slots in the mixed workload
+ * @var churn_call_count The number of calls of the churn slots
+ */
+typedef struct consumer_s
+{
+    linvoke_s *linvoke;
+    pthread_t thread;
+    uint32_t *expected_sequences;
+    uint64_t received_event_count;
+    uint64_t slot_call_count;
+    uint64_t *slot_call_counts;
+    uint64_t lost_event_count;
+    uint64_t duplicated_event_count;
+    uint64_t *latencies;
+    uint64_t latency_count;
+    uint64_t latency_capacity;
+    uint64_t churn_emit_count;
+    uint64_t churn_call_count;
+} consumer_s;
+
+/**
+ * @struct producer_s
+ * @brief A thread that posts events to all consumers in turn
+ * @var index The index of the producer
+ * @var thread The thread
+ */
+typedef struct producer_s
+{
+    uint32_t index;
+    pthread_t thread;
+} producer_s;
+
+/**
+ * @brief The workload, shared by all threads
+ */
+static options_s options = { 4, 2, 8, 2, 1000000, false };
+
+/**
+ * @brief The consumers, which the producers post to
+ */
+static consumer_s *consumers;
+
+/**
+ * @brief The number of producers that posted all of their events
+ */
+static _Atomic uint32_t finished_producer_count;
+
+/**
+ * @brief Returns the current time of the monotonic clock in nanoseconds
+ */
+static uint64_t now(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (uint64_t) time.tv_sec * 1000000000u + (uint64_t) time.tv_nsec;
+}
+
+/**
+ * @brief Compares two latencies for qsort
+ */
+static int compare_latencies(const void *first, const void *second)
+{
+    const uint64_t a = *(const uint64_t *) first;
+    const uint64_t b = *(const uint64_t *) second;
+    return (a > b) - (a < b);
+}
+
+/**
+ * @brief The first slot of every signal, which checks the sequence of the producer and samples the latency
+ */
+static void check_slot(linvoke_event_s *event)
+{
+    consumer_s *const consumer = linvoke_event_get_context(event);
+    const message_s *const message = linvoke_event_get_user_data(event);
+    uint32_t *const expected_sequence = &consumer->expected_sequences[message->producer];
+
+    if (message->sequence > *expected_sequence)
+    {
+        consumer->lost_event_count += message->sequence - *expected_sequence;
+    }
+    else if (message->sequence < *expected_sequence)
+    {
+        ++consumer->duplicated_event_count;
+    }
+
+    if (message->sequence >= *expected_sequence)
+    {
+        *expected_sequence = message->sequence + 1;
+    }
+
+    if (message->post_time != 0 && consumer->latency_count < consumer->latency_capacity)
+    {
+        consumer->latencies[consumer->latency_count++] = now() - message->post_time;
+    }
+
+    ++consumer->received_event_count;
+    ++consumer->slot_call_count;
+}
+
+/**
+ * @brief The other slots of every signal, which only count their calls in the counter given as the context
+ */
+static void count_slot(linvoke_event_s *event)
+{
+    uint64_t *const counter = linvoke_event_get_context(event);
+    ++*counter;
+}
+
+/**
+ * @brief The slot that the mixed workload connects and disconnects between the dispatches
+ */
+static void churn_slot(linvoke_event_s *event)
+{
+    consumer_s *const consumer = linvoke_event_get_context(event);
+    ++consumer->churn_call_count;
+}
+
+/**
+ * @brief Posts the events of one producer, walking over the consumers and signals in turn
+ */
+static void *run_producer(void *argument)
+{
+    const producer_s *const producer = argument;
+    uint32_t *const sequences = calloc(options.consumer_count, sizeof(*sequences));
+
+    for (uint32_t i = 0; i < options.events_per_producer; ++i)
+    {
+        const uint32_t consumer_index = i % options.consumer_count;
+        const uint32_t sequence = sequences[consumer_index]++;
+        const message_s message = {
+            .producer = producer->index,
+            .sequence = sequence,
+            .post_time = sequence % LATENCY_SAMPLE_INTERVAL == 0 ? now() : 0,
+        };
+
+        linvoke_post(consumers[consumer_index].linvoke, (i / options.consumer_count) % options.signal_count, &message, sizeof(message));
+    }
+
+    free(sequences);
+    atomic_fetch_add_explicit(&finished_producer_count, 1, memory_order_release);
+
+    return NULL;
+}
+
+/**
+ * @brief Dispatches the events of one consumer until every producer finished and the post queue is empty
+ */
+static void *run_consumer(void *argument)
+{
+    consumer_s *const consumer = argument;
+    const linvoke_signal churn_signal_id = options.signal_count;
+    struct pollfd poll_fd = { .fd = linvoke_get_fd(consumer->linvoke), .events = POLLIN };
+    uint32_t round = 0;
+
+    while (atomic_load_explicit(&finished_producer_count, memory_order_acquire) < options.producer_count)
+    {
+        poll(&poll_fd, 1, 10);
+        linvoke_dispatch(consumer->linvoke);
+
+        if (options.mixed)
+        {
+            // Connecting and disconnecting rebuilds the slot arrays that the next dispatch reads
+            const linvoke_signal signal_id = round++ % options.signal_count;
+            linvoke_connect_with_context(consumer->linvoke, signal_id, churn_slot, consumer);
+            linvoke_disconnect_with_context(consumer->linvoke, signal_id, churn_slot, consumer);
+
+            linvoke_connect_with_context(consumer->linvoke, churn_signal_id, churn_slot, consumer);
+            linvoke_emit(consumer->linvoke, churn_signal_id, NULL);
+            linvoke_disconnect_with_context(consumer->linvoke, churn_signal_id, churn_slot, consumer);
+            ++consumer->churn_emit_count;
+        }
+    }
+
+    // Every event is committed once its producer finished, so a dispatch that finds nothing means the queue is empty
+    while (linvoke_dispatch(consumer->linvoke) > 0)
+    {
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Prints the usage of the harness
+ */
+static void print_usage(const char *program)
+{
+    fprintf(stderr, "Usage: %s [-p producers] [-c consumers] [-s signals] [-l slots per signal] [-n events per producer] [-m]\n", program);
+    fprintf(stderr, "Posts events from the producer threads to the consumer threads, each of which owns a linvoke object,\n");
+    fprintf(stderr, "checks that every event is delivered exactly once and in order, and reports the throughput and latency.\n");
+    fprintf(stderr, "With -m the consumers also connect, disconnect and emit between the dispatches.\n");
+}
+
+/**
+ * @brief Parses a positive number from the command line
+ */
+static bool parse_count(const char *text, uint32_t *count)
+{
+    char *end;
+    const unsigned long value = strtoul(text, &end, 10);
+
+    if (*text == '\0' || *end != '\0' || value == 0 || value > UINT32_MAX)
+    {
+        return false;
+    }
+
+    *count = (uint32_t) value;
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    int option;
+
+    while ((option = getopt(argc, argv, "p:c:s:l:n:m")) != -1)
+    {
+        bool valid = true;
+
+        switch (option)
+        {
+            case 'p': valid = parse_count(optarg, &options.producer_count); break;
+            case 'c': valid = parse_count(optarg, &options.consumer_count); break;
+            case 's': valid = parse_count(optarg, &options.signal_count); break;
+            case 'l': valid = parse_count(optarg, &options.slots_per_signal); break;
+            case 'n': valid = parse_count(optarg, &options.events_per_producer); break;
+            case 'm': options.mixed = true; break;
+            default: valid = false; break;
+        }
+
+        if (!valid)
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    consumers = calloc(options.consumer_count, sizeof(*consumers));
+    producer_s *const producers = calloc(options.producer_count, sizeof(*producers));
+
+    // Every consumer receives about the same share of the events of every producer
+    const uint64_t events_per_consumer = (uint64_t) options.producer_count * options.events_per_producer / options.consumer_count + options.producer_count;
+
+    for (uint32_t i = 0; i < options.consumer_count; ++i)
+    {
+        consumer_s *const consumer = &consumers[i];
+        consumer->linvoke = linvoke_create();
+        consumer->expected_sequences = calloc(options.producer_count, sizeof(*consumer->expected_sequences));
+        consumer->slot_call_counts = calloc(options.slots_per_signal, sizeof(*consumer->slot_call_counts));
+        consumer->latency_capacity = events_per_consumer / LATENCY_SAMPLE_INTERVAL + options.producer_count;
+        consumer->latencies = malloc(consumer->latency_capacity * sizeof(*consumer->latencies));
+
+        // Producers wait for room instead of dropping events, so every event has to arrive
+        linvoke_set_queue_limit(consumer->linvoke, 0, LINVOKE_OVERFLOW_BLOCK);
+
+        for (linvoke_signal signal_id = 0; signal_id <= options.signal_count; ++signal_id)
+        {
+            linvoke_register_signal(consumer->linvoke, signal_id);
+        }
+
+        for (linvoke_signal signal_id = 0; signal_id < options.signal_count; ++signal_id)
+        {
+            linvoke_connect_with_context(consumer->linvoke, signal_id, check_slot, consumer);
+
+            // The same function is connected again with a different context for every slot
+            for (uint32_t slot = 1; slot < options.slots_per_signal; ++slot)
+            {
+                linvoke_connect_with_context(consumer->linvoke, signal_id, count_slot, &consumer->slot_call_counts[slot]);
+            }
+        }
+    }
+
+    const uint64_t start = now();
+
+    for (uint32_t i = 0; i < options.consumer_count; ++i)
+    {
+        pthread_create(&consumers[i].thread, NULL, run_consumer, &consumers[i]);
+    }
+
+    for (uint32_t i = 0; i < options.producer_count; ++i)
+    {
+        producers[i].index = i;
+        pthread_create(&producers[i].thread, NULL, run_producer, &producers[i]);
+    }
+
+    for (uint32_t i = 0; i < options.producer_count; ++i)
+    {
+        pthread_join(producers[i].thread, NULL);
+    }
+
+    for (uint32_t i = 0; i < options.consumer_count; ++i)
+    {
+        pthread_join(consumers[i].thread, NULL);
+    }
+
+    const double duration = (double) (now() - start) / 1e9;
+
+    // Gather the results of all consumers
+    const uint64_t posted_event_count = (uint64_t) options.producer_count * options.events_per_producer;
+    uint64_t received_event_count = 0;
+    uint64_t slot_call_count = 0;
+    uint64_t expected_slot_call_count = 0;
+    uint64_t lost_event_count = 0;
+    uint64_t duplicated_event_count = 0;
+    uint64_t dropped_event_count = 0;
+    uint64_t churn_mismatch_count = 0;
+    uint64_t latency_count = 0;
+
+    for (uint32_t i = 0; i < options.consumer_count; ++i)
+    {
+        const consumer_s *const consumer = &consumers[i];
+        linvoke_queue_stats_s stats;
+        linvoke_get_queue_stats(consumer->linvoke, &stats);
+
+        received_event_count += consumer->received_event_count;
+        slot_call_count += consumer->slot_call_count;
+
+        for (uint32_t slot = 1; slot < options.slots_per_signal; ++slot)
+        {
+            slot_call_count += consumer->slot_call_counts[slot];
+        }
+
+        expected_slot_call_count += consumer->received_event_count * options.slots_per_signal;
+        lost_event_count += consumer->lost_event_count;
+        duplicated_event_count += consumer->duplicated_event_count;
+        dropped_event_count += stats.dropped_newest_count + stats.dropped_oldest_count;
+        churn_mismatch_count += consumer->churn_emit_count != consumer->churn_call_count;
+        latency_count += consumer->latency_count;
+    }
+
+    uint64_t *const latencies = malloc((latency_count + 1) * sizeof(*latencies));
+    latency_count = 0;
+
+    for (uint32_t i = 0; i < options.consumer_count; ++i)
+    {
+        for (uint64_t j = 0; j < consumers[i].latency_count; ++j)
+        {
+            latencies[latency_count++] = consumers[i].latencies[j];
+        }
+    }
+
+    qsort(latencies, latency_count, sizeof(*latencies), compare_latencies);
+
+    // The last of the events of every producer and consumer pair can be missing, which the sequence checks can not see
+    for (uint32_t i = 0; i < options.consumer_count; ++i)
+    {
+        for (uint32_t j = 0; j < options.producer_count; ++j)
+        {
+            const uint32_t expected_sequence = options.events_per_producer / options.consumer_count + (i < options.events_per_producer % options.consumer_count);
+            lost_event_count += expected_sequence - consumers[i].expected_sequences[j];
+        }
+    }
+
+    printf("%u producers, %u consumers, %u signals, %u slots per signal%s\n", options.producer_count, options.consumer_count, options.signal_count, options.slots_per_signal, options.mixed ? ", mixed" : "");
+    printf("events: %lu posted, %lu received in %.3f ms, %.2f M events/s, %.2f M slot calls/s\n", (unsigned long) posted_event_count, (unsigned long) received_event_count, duration * 1e3, (double) received_event_count / duration / 1e6, (double) slot_call_count / duration / 1e6);
+
+    if (latency_count > 0)
+    {
+        printf("latency: median %.2f us, p99 %.2f us, p99.9 %.2f us, max %.2f us\n", (double) latencies[latency_count / 2] / 1e3, (double) latencies[latency_count * 99 / 100] / 1e3, (double) latencies[latency_count * 999 / 1000] / 1e3, (double) latencies[latency_count - 1] / 1e3);
+    }
+
+    const bool valid = received_event_count == posted_event_count && slot_call_count == expected_slot_call_count && lost_event_count == 0 && duplicated_event_count == 0 && dropped_event_count == 0 && churn_mismatch_count == 0;
+
+    if (!valid)
+    {
+        printf("FAILED: %lu lost, %lu duplicated, %lu dropped, %lu of %lu slot calls, %lu consumers with missing churn calls\n", (unsigned long) lost_event_count, (unsigned long) duplicated_event_count, (unsigned long) dropped_event_count, (unsigned long) slot_call_count, (unsigned long) expected_slot_call_count, (unsigned long) churn_mismatch_count);
+    }
+
+    for (uint32_t i = 0; i < options.consumer_count; ++i)
+    {
+        linvoke_destroy(consumers[i].linvoke);
+        free(consumers[i].expected_sequences);
+        free(consumers[i].slot_call_counts);
+        free(consumers[i].latencies);
+    }
+
+    free(latencies);
+    free(producers);
+    free(consumers);
+
+    return valid ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file:      epoll_dispatch.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+#include <linvoke.h>
+
+/**
+ * @def EVENT_COUNT
+ * @brief The number of events the producer thread posts
+ */
+#define EVENT_COUNT 5
+
+/**
+ * @brief Prints the number that was posted with the event
+ */
+void slot(linvoke_event_s *event)
+{
+    const int *number = linvoke_event_get_user_data(event);
+    printf("Dispatched event %d\n", *number);
+}
+
+/**
+ * @brief Posts events from another thread, with a pause between them
+ */
+void *producer(void *argument)
+{
+    linvoke_s *linvoke = argument;
+
+    for (int i = 0; i < EVENT_COUNT; ++i)
+    {
+        int *number = linvoke_post_reserve(linvoke, 1, sizeof(*number));
+
+        if (number != NULL)
+        {
+            *number = i;
+            linvoke_post_commit(linvoke, number);
+        }
+
+        usleep(100000);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    // Create a linvoke object, register a signal and connect it to the slot
+    linvoke_s *linvoke = linvoke_create();
+    linvoke_register_signal(linvoke, 1);
+    linvoke_connect(linvoke, 1, slot);
+
+    // Add the linvoke eventfd to an epoll instance, next to any other file descriptors of the event loop
+    const int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    struct epoll_event epoll_event = { .events = EPOLLIN, .data.fd = linvoke_get_fd(linvoke) };
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, epoll_event.data.fd, &epoll_event);
+
+    pthread_t producer_thread;
+    pthread_create(&producer_thread, NULL, producer, linvoke);
+
+    // Sleep until events are pending, then dispatch them
+    uint32_t dispatched_event_count = 0;
+
+    while (dispatched_event_count < EVENT_COUNT)
+    {
+        struct epoll_event ready_event;
+
+        if (epoll_wait(epoll_fd, &ready_event, 1, -1) == 1)
+        {
+            dispatched_event_count += linvoke_dispatch(linvoke);
+        }
+    }
+
+    pthread_join(producer_thread, NULL);
+    close(epoll_fd);
+
+    // Destroy the linvoke object to free the used resources
+    linvoke_destroy(linvoke);
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file:      posted_event.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include <stdio.h>
+#include <linvoke.h>
+
+/**
+ * @brief Structure of the payload that is written directly into the post queue
+ */
+typedef struct temperature_sample_s
+{
+    uint32_t sensor;
+    float celsius;
+} temperature_sample_s;
+
+/**
+ * @brief Prints the temperature sample that was posted with the event
+ */
+void slot(linvoke_event_s *event)
+{
+    const temperature_sample_s *sample = linvoke_event_get_user_data(event);
+    printf("Sensor %u: %.1f C\n", sample->sensor, sample->celsius);
+}
+
+int main(void)
+{
+    // Create a linvoke object
+    linvoke_s *linvoke = linvoke_create();
+
+    // Define a unique ID for the signal that is going to be registered
+    const linvoke_signal signal = 42;
+
+    // Register the signal ID and connect it to the slot
+    linvoke_register_signal(linvoke, signal);
+    linvoke_connect(linvoke, signal, slot);
+
+    // Write the payloads straight into the post queue instead of building them elsewhere and copying
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        temperature_sample_s *sample = linvoke_post_reserve(linvoke, signal, sizeof(*sample));
+
+        // The post queue has a fixed size, so it can run out of space if events are not dispatched often enough
+        if (sample == NULL)
+        {
+            break;
+        }
+
+        sample->sensor = i;
+        sample->celsius = 20.0f + (float) i * 1.5f;
+
+        // Publish the event, so it can be dispatched
+        linvoke_post_commit(linvoke, sample);
+    }
+
+    // Emit all posted events. The space they used in the post queue is reclaimed afterwards
+    linvoke_dispatch(linvoke);
+
+    // Destroy the linvoke object to free the used resources
+    linvoke_destroy(linvoke);
+
+    return 0;
+}
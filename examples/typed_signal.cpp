@@ -0,0 +1,50 @@
+/**
+ * @file:      typed_signal.cpp
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include <cstdio>
+#include <string>
+#include <linvoke.hpp>
+
+int main()
+{
+    // Create a linvoke object
+    linvoke_s *lv = linvoke_create();
+
+    // Define a unique ID for the signal that is going to be registered
+    const linvoke_signal signal_id = 5;
+
+    // Register the signal ID
+    linvoke_register_signal(lv, signal_id);
+
+    {
+        // Create a typed handle to the signal. The arguments of emit are checked at compile time
+        const linvoke::signal<const std::string &, int> signal(lv, signal_id);
+
+        // Connect a lambda with a capture. The lambda is stored inside the returned connection,
+        // so no memory is allocated for it, and it is disconnected when the connection goes out of scope
+        int event_count = 0;
+        auto connection = signal.connect([&event_count](const std::string &name, int value)
+        {
+            ++event_count;
+            std::printf("Event %d: %s = %d\n", event_count, name.c_str(), value);
+        });
+
+        // Emit an event from the signal with typed arguments
+        signal.emit("temperature", 21);
+        signal.emit("humidity", 40);
+    }
+
+    // Destroy the linvoke object to free the used resources
+    linvoke_destroy(lv);
+
+    return 0;
+}
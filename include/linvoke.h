@@ -12,7 +12,13 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 /**
  * @struct linvoke_s
@@ -26,6 +32,12 @@ typedef struct linvoke_s linvoke_s;
  */
 typedef struct linvoke_event_s linvoke_event_s;
 
+/**
+ * @struct linvoke_bridge_s
+ * @brief Structure that holds a ring of events in memory that is shared between processes
+ */
+typedef struct linvoke_bridge_s linvoke_bridge_s;
+
 /**
  * @typedef linvoke_slot_pointer
  * @brief Pointer to a function that will be called when an event is emitted
@@ -38,16 +50,138 @@ typedef void (*linvoke_slot_pointer)(linvoke_event_s *event);
  */
 typedef uint32_t linvoke_signal;
 
+/**
+ * @enum linvoke_overflow_policy
+ * @brief What happens to a posted event when the queue it is posted to already holds its limit of pending events
+ * @var LINVOKE_OVERFLOW_BLOCK The producer sleeps until a dispatch makes room. Must not be used from the thread that dispatches
+ * @var LINVOKE_OVERFLOW_DROP_NEWEST The new event is dropped
+ * @var LINVOKE_OVERFLOW_DROP_OLDEST The oldest pending event is dropped when it is dispatched, so the new event fits
+ * @var LINVOKE_OVERFLOW_COALESCE All pending events of the signal are dropped in favour of the new event.
+ *      Only available for the queue limit of a signal
+ */
+typedef enum linvoke_overflow_policy
+{
+    LINVOKE_OVERFLOW_BLOCK,
+    LINVOKE_OVERFLOW_DROP_NEWEST,
+    LINVOKE_OVERFLOW_DROP_OLDEST,
+    LINVOKE_OVERFLOW_COALESCE,
+} linvoke_overflow_policy;
+
+/**
+ * @enum linvoke_post_status
+ * @brief The outcome of posting an event
+ * @var LINVOKE_POST_QUEUED The event was queued
+ * @var LINVOKE_POST_REPLACED The event was queued in place of one or more older pending events, which will not be dispatched
+ * @var LINVOKE_POST_DROPPED The queue was full and the event was dropped
+ * @var LINVOKE_POST_FAILED The event can never fit in the post queue, because it is larger than half of the post queue
+ */
+typedef enum linvoke_post_status
+{
+    LINVOKE_POST_QUEUED,
+    LINVOKE_POST_REPLACED,
+    LINVOKE_POST_DROPPED,
+    LINVOKE_POST_FAILED,
+} linvoke_post_status;
+
+/**
+ * @struct linvoke_queue_stats_s
+ * @brief Overflow counters of a post queue or of the posted events of one signal
+ * @var dropped_newest_count The number of new events that were dropped because the queue was full
+ * @var dropped_oldest_count The number of pending events that were dropped to make room for new ones
+ * @var coalesced_count The number of pending events that were dropped in favour of a newer event of the same signal
+ * @var blocked_count The number of times a producer had to wait for room
+ * @var blocked_nanoseconds The total time producers spent waiting for room
+ */
+typedef struct linvoke_queue_stats_s
+{
+    uint64_t dropped_newest_count;
+    uint64_t dropped_oldest_count;
+    uint64_t coalesced_count;
+    uint64_t blocked_count;
+    uint64_t blocked_nanoseconds;
+} linvoke_queue_stats_s;
+
+/**
+ * @def LINVOKE_PRIORITY_COUNT
+ * @brief The number of priority lanes of the post queue. Priority 0 is the lowest and the default of every signal
+ */
+#ifndef LINVOKE_PRIORITY_COUNT
+#define LINVOKE_PRIORITY_COUNT 4
+#endif
+
+/**
+ * @def LINVOKE_PRIORITY_LANE_SIZE
+ * @brief The size of the ring buffer of every priority lane above 0 in bytes. Must be a power of two.
+ *        Lane 0 has the full LINVOKE_POST_QUEUE_SIZE, since it carries the bulk of the events
+ */
+#ifndef LINVOKE_PRIORITY_LANE_SIZE
+#define LINVOKE_PRIORITY_LANE_SIZE 8192
+#endif
+
+#ifdef LINVOKE_MAX_SIGNALS
+/*
+ * Static configuration: defining LINVOKE_MAX_SIGNALS when compiling the library and the code that uses it
+ * gives every array of a linvoke object a fixed capacity, so the library never allocates memory.
+ * Registering or connecting beyond the capacity fails like a failed allocation does in the dynamic configuration.
+ * Unregistered signals and disconnected slots keep their place until linvoke_compact is called.
+ * The worker pool of parallel signals and the bridges are not available in this configuration.
+ */
+
+/**
+ * @def LINVOKE_MAX_SLOTS_PER_SIGNAL
+ * @brief The number of slots that can be connected to each signal in the static configuration
+ */
+#ifndef LINVOKE_MAX_SLOTS_PER_SIGNAL
+#define LINVOKE_MAX_SLOTS_PER_SIGNAL 16
+#endif
+
+/**
+ * @def LINVOKE_POST_QUEUE_SIZE
+ * @brief The size of the post queue ring buffer in bytes. Must be a power of two
+ */
+#ifndef LINVOKE_POST_QUEUE_SIZE
+#define LINVOKE_POST_QUEUE_SIZE 65536
+#endif
+
+/**
+ * @def LINVOKE_STORAGE_SIZE
+ * @brief An upper bound on the size of a linvoke object in the static configuration.
+ *        The library checks at compile time that the object fits
+ */
+#define LINVOKE_STORAGE_SIZE (1024 + LINVOKE_PRIORITY_COUNT * 256 + LINVOKE_POST_QUEUE_SIZE + (LINVOKE_PRIORITY_COUNT - 1) * LINVOKE_PRIORITY_LANE_SIZE + (uint64_t) LINVOKE_MAX_SIGNALS * (192 + LINVOKE_MAX_SLOTS_PER_SIGNAL * 2 * sizeof(void *)))
+
+/**
+ * @struct linvoke_storage_s
+ * @brief Memory for a linvoke object in the static configuration, which can be placed in static or automatic storage
+ */
+typedef struct linvoke_storage_s
+{
+#ifdef __cplusplus
+    alignas(64) unsigned char bytes[LINVOKE_STORAGE_SIZE];
+#else
+    _Alignas(64) unsigned char bytes[LINVOKE_STORAGE_SIZE];
+#endif
+} linvoke_storage_s;
+
+/**
+ * @fn linvoke_init
+ * @brief Creates a new linvoke object inside memory provided by the caller
+ * @param storage Pointer to the memory of the linvoke object, which must outlive it
+ * @return Pointer to the created linvoke object, which points into the storage
+ */
+linvoke_s *linvoke_init(linvoke_storage_s *const storage);
+#else
 /**
  * @fn linvoke_create
  * @brief Creates a new linvoke object
  * @return Pointer to the created linvoke object
  */
 linvoke_s *linvoke_create(void);
+#endif
 
 /**
  * @fn linvoke_destroy
- * @brief Destroys a linvoke object
+ * @brief Destroys a linvoke object. In the static configuration the storage itself is left to the caller
  * @param linvoke Pointer to a linvoke object
  */
 void linvoke_destroy(linvoke_s *const linvoke);
@@ -56,10 +190,23 @@ void linvoke_destroy(linvoke_s *const linvoke);
  * @fn linvoke_register_signal
  * @brief Registers a new signal with a given ID
  * @param linvoke Pointer to a linvoke object
- * @param signal_id The ID of the signal that will be registered
+ * @param signal_id The ID of the signal that will be registered. Outside of the static configuration,
+ *        the IDs from LINVOKE_NAMED_SIGNAL_ID_BASE on are reserved for named signals
  */
 void linvoke_register_signal(linvoke_s *const linvoke, const linvoke_signal signal_id);
 
+/**
+ * @fn linvoke_register_signals
+ * @brief Registers multiple new signals with the given IDs at once.
+ *        Memory is reallocated at most once and duplicate IDs are detected in a single hash pass,
+ *        so registering many signals this way is linear in the number of signals.
+ *        IDs that are already registered, or appear more than once, are skipped
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_ids An array of IDs of the signals that will be registered
+ * @param signal_count The number of IDs in the signal_ids array
+ */
+void linvoke_register_signals(linvoke_s *const linvoke, const linvoke_signal *const signal_ids, const uint32_t signal_count);
+
 /**
  * @fn linvoke_connect
  * @brief Connects a new slot to an signal. The callback functions will be called in the order they were connected
@@ -69,6 +216,72 @@ void linvoke_register_signal(linvoke_s *const linvoke, const linvoke_signal sign
  */
 void linvoke_connect(linvoke_s *const linvoke, const linvoke_signal signal_id, linvoke_slot_pointer slot);
 
+/**
+ * @fn linvoke_connect_with_context
+ * @brief Connects a new slot to a signal together with a context pointer, which the slot can get from the event
+ *        with linvoke_event_get_context. The same function can be connected multiple times with different contexts
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal to which the slot will be connected
+ * @param slot The slot that will be called when an event is emitted
+ * @param context The context that will be passed to the slot. Can be NULL
+ * @return true if the slot was connected, false if the signal does not exist, the slot is already connected
+ *         with the same context or the memory for it could not be allocated
+ */
+bool linvoke_connect_with_context(linvoke_s *const linvoke, const linvoke_signal signal_id, linvoke_slot_pointer slot, void *context);
+
+/**
+ * @fn linvoke_connect_many
+ * @brief Connects multiple slots to a signal at once, in the order they appear in the given array.
+ *        Memory is reallocated at most once and duplicate slots are detected in a single hash pass.
+ *        Slots that are already connected, or appear more than once, are skipped
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal to which the slots will be connected
+ * @param slots An array of slots that will be called when an event is emitted
+ * @param slot_count The number of slots in the slots array
+ */
+void linvoke_connect_many(linvoke_s *const linvoke, const linvoke_signal signal_id, const linvoke_slot_pointer *const slots, const uint32_t slot_count);
+
+/**
+ * @fn linvoke_disconnect
+ * @brief Disconnects a slot from a signal in constant time. The other slots keep their order.
+ *        The slot leaves a tombstone in the slots array, which is skipped when emitting and removed by linvoke_compact,
+ *        or by a later connect that would otherwise grow a slots array that is at least half tombstones.
+ *        It is safe to disconnect slots from within a slot that is being called
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal from which the slot will be disconnected
+ * @param slot The slot that will no longer be called when an event is emitted
+ */
+void linvoke_disconnect(linvoke_s *const linvoke, const linvoke_signal signal_id, linvoke_slot_pointer slot);
+
+/**
+ * @fn linvoke_disconnect_with_context
+ * @brief Disconnects a slot that was connected with linvoke_connect_with_context, in the same way as linvoke_disconnect
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal from which the slot will be disconnected
+ * @param slot The slot that will no longer be called when an event is emitted
+ * @param context The context the slot was connected with
+ */
+void linvoke_disconnect_with_context(linvoke_s *const linvoke, const linvoke_signal signal_id, linvoke_slot_pointer slot, void *context);
+
+/**
+ * @fn linvoke_unregister_signal
+ * @brief Unregisters a signal with a given ID in constant time and disconnects all of its slots.
+ *        The signal leaves a tombstone in the signals array, which is removed by linvoke_compact together with the slots.
+ *        It is safe to unregister a signal from within one of its slots, the slots that were not called yet are skipped
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal that will be unregistered
+ */
+void linvoke_unregister_signal(linvoke_s *const linvoke, const linvoke_signal signal_id);
+
+/**
+ * @fn linvoke_compact
+ * @brief Removes the tombstones left by linvoke_disconnect and linvoke_unregister_signal, rebuilds the lookup indices
+ *        and returns the unused capacity of all arrays to the allocator, so the memory use follows the live signals and slots.
+ *        Must not be called from within a slot
+ * @param linvoke Pointer to a linvoke object
+ */
+void linvoke_compact(linvoke_s *const linvoke);
+
 /**
  * @fn linvoke_emit
  * @brief Emits an event from a given signal with given data
@@ -78,6 +291,555 @@ void linvoke_connect(linvoke_s *const linvoke, const linvoke_signal signal_id, l
  */
 void linvoke_emit(linvoke_s *const linvoke, const linvoke_signal signal_id, void *user_data);
 
+/**
+ * @fn linvoke_emit_typed
+ * @brief Emits an event from a given signal with given data and the type of that data, which the slots can get
+ *        from the event with linvoke_event_get_type before they read the user data. Events emitted in any other way,
+ *        including the recorded, posted and replayed copies of typed events, have no type
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal which will emit an event
+ * @param user_data The user data that will be passed to the connected slots. Can be NULL
+ * @param type An address that identifies the type of the user data, usually of a static object. Can be NULL
+ */
+void linvoke_emit_typed(linvoke_s *const linvoke, const linvoke_signal signal_id, void *user_data, const void *type);
+
+#ifndef LINVOKE_MAX_SIGNALS
+/**
+ * @fn linvoke_set_parallel
+ * @brief Marks a signal whose slots are independent of each other, so one emitted event can call them from several threads.
+ *        Events with at least LINVOKE_PARALLEL_THRESHOLD slots are split across a pool of worker threads,
+ *        and the emitting thread calls a share of the slots as well. linvoke_emit still returns only after every slot returned.
+ *        Slots must not connect or disconnect slots of the signal while the event is emitted
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal
+ * @param parallel Whether the slots of the signal may be called in parallel
+ */
+void linvoke_set_parallel(linvoke_s *const linvoke, const linvoke_signal signal_id, const bool parallel);
+
+/**
+ * @fn linvoke_set_profile_rate
+ * @brief Makes linvoke_emit measure how long every slot call of every Nth emitted event takes, aggregated per slot function.
+ *        Sampled events call their slots on the emitting thread, even if the signal is parallel, and the events that the slots
+ *        of parallel signals emit on the worker threads are never sampled. The rate can be changed from any thread at any
+ *        time, which restarts the count towards the next sampled event. The samples that were taken are kept and keep
+ *        counting for the rate they were taken at
+ * @param linvoke Pointer to a linvoke object
+ * @param rate Sample one of every rate events, or 0 to stop sampling. Profiling is off by default
+ */
+void linvoke_set_profile_rate(linvoke_s *const linvoke, const uint32_t rate);
+
+/**
+ * @fn linvoke_profile_report
+ * @brief Prints the slot functions that took the most sampled time, with their number of samples, the estimated number
+ *        of calls, their share of the sampled time and the mean, median, 90th and 99th percentile and longest duration.
+ *        Must be called from the thread that emits the events
+ * @param linvoke Pointer to a linvoke object
+ * @param stream The stream to print to, like stdout
+ * @param top_n The number of slot functions to print, or 0 to print all of them
+ */
+void linvoke_profile_report(linvoke_s *const linvoke, FILE *const stream, const uint32_t top_n);
+
+/**
+ * @fn linvoke_profile_reset
+ * @brief Forgets the samples of every slot function. Must be called from the thread that emits the events
+ * @param linvoke Pointer to a linvoke object
+ */
+void linvoke_profile_reset(linvoke_s *const linvoke);
+
+/**
+ * @def LINVOKE_NO_SIGNAL
+ * @brief Returned instead of a signal ID by the functions for named signals when there is no such signal
+ */
+#define LINVOKE_NO_SIGNAL UINT32_MAX
+
+/**
+ * @def LINVOKE_NAMED_SIGNAL_ID_BASE
+ * @brief The first ID given to named signals. Named signals get the IDs from here on in the order their names are
+ *        first registered. linvoke_register_signal rejects the IDs of this range, so integer IDs never collide with them
+ */
+#define LINVOKE_NAMED_SIGNAL_ID_BASE 0x80000000u
+
+/**
+ * @struct linvoke_named_signal_s
+ * @brief A signal name together with its hash and the ID it was resolved to, so emitting it by name repeatedly
+ *        skips hashing and looking up the name. Initialize it with LINVOKE_NAMED_SIGNAL and keep it, for example in a static variable
+ * @var name The name of the signal, which must outlive the structure
+ * @var hash The hash of the name, or 0 until it is computed
+ * @var owner The serial number of the linvoke object the ID was resolved in, or 0 if it was not resolved yet
+ * @var signal_id The resolved ID of the signal
+ */
+typedef struct linvoke_named_signal_s
+{
+    const char *name;
+    uint64_t hash;
+    uint64_t owner;
+    linvoke_signal signal_id;
+} linvoke_named_signal_s;
+
+/**
+ * @def LINVOKE_NAMED_SIGNAL
+ * @brief Initializer of a linvoke_named_signal_s for a given name
+ */
+#define LINVOKE_NAMED_SIGNAL(signal_name) { (signal_name), 0, 0, 0 }
+
+/**
+ * @fn linvoke_register_named
+ * @brief Registers a signal that is identified by a name. The name is interned, so it keeps its ID for the lifetime
+ *        of the linvoke object, even if the signal is unregistered and registered again.
+ *        Registering the name of a signal that is already registered does nothing and returns its ID
+ * @param linvoke Pointer to a linvoke object
+ * @param name The name of the signal, which is copied
+ * @return The ID of the signal, which can be used with every other function, or LINVOKE_NO_SIGNAL if it could not be
+ *         registered or the IDs of the named signals are used up
+ */
+linvoke_signal linvoke_register_named(linvoke_s *const linvoke, const char *const name);
+
+/**
+ * @fn linvoke_find_named
+ * @brief Get the ID of a named signal
+ * @param linvoke Pointer to a linvoke object
+ * @param name The name of the signal
+ * @return The ID of the signal, or LINVOKE_NO_SIGNAL if no signal was ever registered with this name
+ */
+linvoke_signal linvoke_find_named(linvoke_s *const linvoke, const char *const name);
+
+/**
+ * @fn linvoke_emit_named
+ * @brief Emits an event from a named signal. The name is only hashed and looked up the first time the structure
+ *        is used with a linvoke object, after that this costs the same as linvoke_emit
+ * @param linvoke Pointer to a linvoke object
+ * @param signal Pointer to the named signal, whose cached ID is updated
+ * @param user_data The user data that will be passed to the connected slots. Can be NULL
+ */
+void linvoke_emit_named(linvoke_s *const linvoke, linvoke_named_signal_s *const signal, void *user_data);
+
+/**
+ * @fn linvoke_connect_keyed
+ * @brief Connects a slot to a signal that is only called for the events emitted with linvoke_emit_keyed and the same key.
+ *        The keyed slots of a signal are kept in a hash table from key to slots, so emitting costs the same no matter
+ *        how many other keys have slots. linvoke_emit does not call keyed slots
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal to which the slot will be connected
+ * @param key The key, for example the ID of the object the slot is interested in
+ * @param slot The slot that will be called when an event with the key is emitted
+ */
+void linvoke_connect_keyed(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint64_t key, linvoke_slot_pointer slot);
+
+/**
+ * @fn linvoke_connect_keyed_with_context
+ * @brief Connects a keyed slot together with a context pointer, in the same way as linvoke_connect_with_context
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal to which the slot will be connected
+ * @param key The key
+ * @param slot The slot that will be called when an event with the key is emitted
+ * @param context The context that will be passed to the slot. Can be NULL
+ * @return true if the slot was connected, false if the signal does not exist, the slot is already connected for the key
+ *         with the same context or the memory for it could not be allocated
+ */
+bool linvoke_connect_keyed_with_context(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint64_t key, linvoke_slot_pointer slot, void *context);
+
+/**
+ * @fn linvoke_disconnect_keyed
+ * @brief Disconnects a keyed slot. The key stays in the hash table until the linvoke object is compacted.
+ *        It is safe to disconnect slots from within a slot that is being called
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal from which the slot will be disconnected
+ * @param key The key the slot was connected for
+ * @param slot The slot that will no longer be called
+ */
+void linvoke_disconnect_keyed(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint64_t key, linvoke_slot_pointer slot);
+
+/**
+ * @fn linvoke_disconnect_keyed_with_context
+ * @brief Disconnects a keyed slot that was connected with linvoke_connect_keyed_with_context
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal from which the slot will be disconnected
+ * @param key The key the slot was connected for
+ * @param slot The slot that will no longer be called
+ * @param context The context the slot was connected with
+ */
+void linvoke_disconnect_keyed_with_context(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint64_t key, linvoke_slot_pointer slot, void *context);
+
+/**
+ * @fn linvoke_emit_keyed
+ * @brief Emits an event from a signal to the slots connected for a key. The unkeyed slots of the signal are called first,
+ *        exactly like linvoke_emit does, then the keyed slots of the key in the order they were connected.
+ *        The event is recorded like any other, so replaying a log only calls the unkeyed slots
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal which will emit an event
+ * @param key The key whose slots are called
+ * @param user_data The user data that will be passed to the connected slots. Can be NULL
+ */
+void linvoke_emit_keyed(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint64_t key, void *user_data);
+
+/**
+ * @fn linvoke_get_keyed_slot_count
+ * @brief Get the number of slots that are connected to a signal for a given key
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal to which the slots are connected
+ * @param key The key
+ * @return The number of slots connected for the key
+ */
+uint32_t linvoke_get_keyed_slot_count(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint64_t key);
+
+/**
+ * @typedef linvoke_timer
+ * @brief Handle of a delayed or periodic emission, which can be used to cancel it
+ */
+typedef uint64_t linvoke_timer;
+
+/**
+ * @def LINVOKE_NO_TIMER
+ * @brief Returned instead of a timer handle when the timer could not be scheduled
+ */
+#define LINVOKE_NO_TIMER 0
+
+/**
+ * @fn linvoke_emit_after
+ * @brief Emits an event from a signal once the time of the linvoke object, which only linvoke_advance_time moves,
+ *        reached the current time plus a delay. The time has no unit of its own, the application picks one, like
+ *        milliseconds, and uses it for all delays. Scheduling and cancelling take constant time
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal which will emit the event. It only has to be registered when the event is emitted
+ * @param user_data The user data that will be passed to the connected slots, which must stay valid until then. Can be NULL
+ * @param delay The number of ticks until the event is emitted. A delay of 0 is treated as 1
+ * @return The handle of the timer, or LINVOKE_NO_TIMER if it could not be scheduled
+ */
+linvoke_timer linvoke_emit_after(linvoke_s *const linvoke, const linvoke_signal signal_id, void *user_data, const uint64_t delay);
+
+/**
+ * @fn linvoke_emit_every
+ * @brief Emits an event from a signal every period ticks, starting one period after the current time, until it is cancelled.
+ *        The expiries are multiples of the period from the start, even if linvoke_advance_time is called late
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal which will emit the events
+ * @param user_data The user data that will be passed to the connected slots, which must stay valid until the timer is cancelled. Can be NULL
+ * @param period The number of ticks between the events. Must not be 0
+ * @return The handle of the timer, or LINVOKE_NO_TIMER if it could not be scheduled
+ */
+linvoke_timer linvoke_emit_every(linvoke_s *const linvoke, const linvoke_signal signal_id, void *user_data, const uint64_t period);
+
+/**
+ * @fn linvoke_cancel_timer
+ * @brief Cancels a delayed or periodic emission. Can be called from the slots that the timers emit to
+ * @param linvoke Pointer to a linvoke object
+ * @param timer The handle of the timer
+ * @return true if the timer was cancelled, false if it already expired or was cancelled before
+ */
+bool linvoke_cancel_timer(linvoke_s *const linvoke, const linvoke_timer timer);
+
+/**
+ * @fn linvoke_advance_time
+ * @brief Moves the time of a linvoke object forward, emitting the events of every timer that expires on the way,
+ *        in the order of their expiries. The time starts at 0 and is only ever changed by this function,
+ *        so timers are deterministic and can be tested without a real clock. Must not be called from a slot
+ * @param linvoke Pointer to a linvoke object
+ * @param now The new time. A time before the current time is ignored
+ * @return The number of emitted events
+ */
+uint32_t linvoke_advance_time(linvoke_s *const linvoke, const uint64_t now);
+
+/**
+ * @fn linvoke_get_time
+ * @brief Get the time that linvoke_advance_time last moved a linvoke object to
+ * @param linvoke Pointer to a linvoke object
+ * @return The current time
+ */
+uint64_t linvoke_get_time(linvoke_s *const linvoke);
+#endif
+
+/**
+ * @def LINVOKE_LOG_MAGIC
+ * @brief The first bytes of every event log, which also carry the version of the format
+ */
+#define LINVOKE_LOG_MAGIC "LNVKLOG2"
+
+/**
+ * @def LINVOKE_LOG_ALIGNMENT
+ * @brief The payload of every record in an event log is padded to a multiple of this many bytes
+ */
+#define LINVOKE_LOG_ALIGNMENT 8
+
+/**
+ * @struct linvoke_log_header_s
+ * @brief The header at the start of an event log. The records follow it directly.
+ *        All values are stored in the byte order of the machine that recorded the log
+ * @var magic Always LINVOKE_LOG_MAGIC, without the terminating zero
+ * @var length The number of bytes up to the end of the last complete record, including the header. It is updated after
+ *      every record, so a log that was never closed, because the recording process crashed, still ends at its last event
+ */
+typedef struct linvoke_log_header_s
+{
+    char magic[8];
+    uint64_t length;
+} linvoke_log_header_s;
+
+/**
+ * @struct linvoke_log_record_s
+ * @brief A recorded event. The payload follows the record directly and is padded to a multiple of LINVOKE_LOG_ALIGNMENT bytes
+ * @var timestamp The time of the monotonic clock in nanoseconds when the event was emitted
+ * @var signal_id The ID of the signal that emitted the event
+ * @var payload_size The number of payload bytes, without the padding
+ */
+typedef struct linvoke_log_record_s
+{
+    uint64_t timestamp;
+    linvoke_signal signal_id;
+    uint32_t payload_size;
+} linvoke_log_record_s;
+
+/**
+ * @fn linvoke_record_start
+ * @brief Starts appending every emitted event to an event log, with the time it was emitted, the ID of its signal
+ *        and the payload bytes selected with linvoke_record_payload. The log is written through a shared memory mapping,
+ *        so recording an event does not make a system call, unless the log has to grow. Events that the slots of parallel
+ *        signals emit on the worker threads are recorded in the order they were appended. Must not be called while an event
+ *        is being emitted
+ * @param linvoke Pointer to a linvoke object
+ * @param path The path of the log file, which is created or truncated
+ * @return true if the log file was created, false otherwise
+ */
+bool linvoke_record_start(linvoke_s *const linvoke, const char *const path);
+
+/**
+ * @fn linvoke_record_stop
+ * @brief Stops recording and closes the event log. Does nothing if nothing is being recorded.
+ *        Must not be called while an event is being emitted
+ * @param linvoke Pointer to a linvoke object
+ */
+void linvoke_record_stop(linvoke_s *const linvoke);
+
+/**
+ * @fn linvoke_record_payload
+ * @brief Sets the number of bytes of the user data that are recorded with every event of a signal. By default, no bytes are recorded.
+ *        Events emitted with NULL user data are always recorded without a payload
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal
+ * @param payload_size The number of bytes copied from the user data into the log
+ */
+void linvoke_record_payload(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint32_t payload_size);
+
+/**
+ * @fn linvoke_replay
+ * @brief Emits the events of an event log again, in the order they were recorded. The slots receive a pointer to a copy
+ *        of the recorded payload as the user data, or NULL for events recorded without a payload.
+ *        The signals of the log have to be registered in the linvoke object
+ * @param linvoke Pointer to a linvoke object
+ * @param path The path of the log file
+ * @param speed How many times faster than the original timing the events are emitted, or 0 to emit them as fast as possible
+ * @return The number of replayed events
+ */
+uint32_t linvoke_replay(linvoke_s *const linvoke, const char *const path, const double speed);
+
+/**
+ * @fn linvoke_set_priority
+ * @brief Sets the priority lane that the posted events of a signal are queued in. Dispatching drains higher lanes first.
+ *        Producers look the signal up while posting, so signals must not be registered, unregistered or compacted
+ *        while other threads post events once any signal has a priority above 0
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal
+ * @param priority The lane, from 0 to LINVOKE_PRIORITY_COUNT - 1
+ */
+void linvoke_set_priority(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint32_t priority);
+
+/**
+ * @fn linvoke_set_queue_limit
+ * @brief Limits the number of events that can be pending in the post queue of a linvoke object.
+ *        Independent of the limit, the post queue never holds more than LINVOKE_POST_QUEUE_SIZE bytes, and when those are
+ *        used up the policy also decides what happens, except that older events can not make room in that case
+ * @param linvoke Pointer to a linvoke object
+ * @param max_events The number of pending events, or 0 to only limit the size of the post queue
+ * @param policy What happens when the limit is reached. LINVOKE_OVERFLOW_COALESCE is not supported here
+ */
+void linvoke_set_queue_limit(linvoke_s *const linvoke, const uint32_t max_events, const linvoke_overflow_policy policy);
+
+/**
+ * @fn linvoke_set_signal_queue_limit
+ * @brief Limits the number of posted events of a signal that can be pending at once.
+ *        Producers look the signal up while posting, so signals must not be registered, unregistered or compacted
+ *        while other threads post events once any signal has a limit
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal
+ * @param max_events The number of pending events, or 0 to remove the limit
+ * @param policy What happens when the limit is reached
+ */
+void linvoke_set_signal_queue_limit(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint32_t max_events, const linvoke_overflow_policy policy);
+
+/**
+ * @fn linvoke_get_queue_stats
+ * @brief Get the overflow counters of the post queue of a linvoke object
+ * @param linvoke Pointer to a linvoke object
+ * @param stats Pointer to the structure that receives the counters
+ */
+void linvoke_get_queue_stats(linvoke_s *const linvoke, linvoke_queue_stats_s *const stats);
+
+/**
+ * @fn linvoke_get_signal_queue_stats
+ * @brief Get the overflow counters of the posted events of a signal, which only count while the signal has a limit.
+ *        New events that are dropped because the post queue is out of space count as dropped for both queues
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal
+ * @param stats Pointer to the structure that receives the counters
+ */
+void linvoke_get_signal_queue_stats(linvoke_s *const linvoke, const linvoke_signal signal_id, linvoke_queue_stats_s *const stats);
+
+/**
+ * @fn linvoke_post
+ * @brief Copies an event into the post queue of a linvoke object, applying the queue limits and their policies.
+ *        Safe to call from multiple threads at once
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal which will emit the event when it is dispatched
+ * @param payload The bytes that are copied into the post queue. Can be NULL if the size is 0
+ * @param size The size of the payload in bytes. Together with its headers, it must not exceed half of the post queue
+ * @return The outcome of the post
+ */
+linvoke_post_status linvoke_post(linvoke_s *const linvoke, const linvoke_signal signal_id, const void *const payload, const uint32_t size);
+
+/**
+ * @fn linvoke_post_reserve
+ * @brief Reserves space for an event record in the post queue of a linvoke object.
+ *        The event is not visible to linvoke_dispatch until it is published with linvoke_post_commit.
+ *        Reserving and committing is safe to do from multiple threads at once. The queue limits apply like for linvoke_post
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal which will emit the event when it is dispatched
+ * @param size The size of the payload in bytes. Can be 0. Together with its headers, it must not exceed half of the post queue
+ * @return Pointer to a writable payload of the given size (aligned to 8 bytes), or NULL if the event was dropped or can never fit
+ */
+void *linvoke_post_reserve(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint32_t size);
+
+/**
+ * @fn linvoke_post_commit
+ * @brief Publishes an event record that was previously reserved with linvoke_post_reserve
+ * @param linvoke Pointer to a linvoke object
+ * @param payload The pointer that was returned by linvoke_post_reserve
+ */
+void linvoke_post_commit(linvoke_s *const linvoke, void *const payload);
+
+/**
+ * @fn linvoke_dispatch
+ * @brief Emits all events that were committed to the post queue before this call, in the order they were reserved.
+ *        The slots receive a pointer to the payload inside the post queue as the user data of the event,
+ *        which is only valid until the slot returns. The space of the dispatched records is reclaimed after the drain.
+ *        Only one thread may dispatch at a time
+ * @param linvoke Pointer to a linvoke object
+ * @return The number of dispatched events
+ */
+uint32_t linvoke_dispatch(linvoke_s *const linvoke);
+
+/**
+ * @fn linvoke_dispatch_with_budget
+ * @brief Works like linvoke_dispatch, but stops once a number of events was emitted or some time passed, so a flood of
+ *        events can not hold up the thread that dispatches them. Higher priority lanes are drained first, but a lane that
+ *        was left with events by several budgeted dispatches in a row is drained first by the next one, so it is never starved.
+ *        If events are left, the eventfd stays readable
+ * @param linvoke Pointer to a linvoke object
+ * @param max_events The number of events after which the dispatch stops, or 0 for no limit
+ * @param max_nanoseconds The time after which the dispatch stops, or 0 for no limit. The clock is only read every few events
+ * @return The number of dispatched events
+ */
+uint32_t linvoke_dispatch_with_budget(linvoke_s *const linvoke, const uint32_t max_events, const uint64_t max_nanoseconds);
+
+/**
+ * @fn linvoke_get_fd
+ * @brief Get an eventfd that becomes readable when posted events are pending, so the thread that dispatches the events
+ *        can sleep in poll, select or epoll_wait. The eventfd is created on the first call and is owned by the linvoke object.
+ *        Producers only signal it when the post queue goes from empty to non-empty, and linvoke_dispatch resets it.
+ *        Must be called from the thread that dispatches the events
+ * @param linvoke Pointer to a linvoke object
+ * @return The file descriptor of the eventfd, or -1 if it could not be created
+ */
+int linvoke_get_fd(linvoke_s *const linvoke);
+
+#ifndef LINVOKE_MAX_SIGNALS
+/**
+ * @fn linvoke_bridge_create
+ * @brief Creates a bridge that carries events from one or more processes to one receiving process.
+ *        The events are stored in a ring buffer in a memfd, which is shared with the other processes by inheriting
+ *        the bridge through fork, or by passing the file descriptor from linvoke_bridge_get_fd to linvoke_bridge_open
+ * @param size The size of the ring buffer in bytes. Must be a power of two
+ * @return Pointer to the created bridge or NULL if it could not be created
+ */
+linvoke_bridge_s *linvoke_bridge_create(const uint32_t size);
+
+/**
+ * @fn linvoke_bridge_open
+ * @brief Opens a bridge that was created in another process
+ * @param fd The file descriptor of the bridge memfd. The bridge keeps its own duplicate, so the caller can close it
+ * @return Pointer to the opened bridge or NULL if the file descriptor does not refer to a bridge
+ */
+linvoke_bridge_s *linvoke_bridge_open(const int fd);
+
+/**
+ * @fn linvoke_bridge_destroy
+ * @brief Unmaps a bridge from the calling process. The shared memory is released once every process has destroyed its bridge.
+ *        Signals that are forwarded to the bridge must be unregistered, or their linvoke object destroyed, before this call
+ * @param bridge Pointer to a bridge
+ */
+void linvoke_bridge_destroy(linvoke_bridge_s *const bridge);
+
+/**
+ * @fn linvoke_bridge_get_fd
+ * @brief Get the file descriptor of the bridge memfd, which can be passed to another process over a unix socket.
+ *        The file descriptor is owned by the bridge and is closed on exec
+ * @param bridge Pointer to a bridge
+ * @return The file descriptor of the bridge memfd
+ */
+int linvoke_bridge_get_fd(linvoke_bridge_s *const bridge);
+
+/**
+ * @fn linvoke_bridge_forward
+ * @brief Connects a slot to a signal that copies the payload of every emitted event into a bridge,
+ *        so the event is emitted again when the receiving process calls linvoke_bridge_dispatch.
+ *        The user data of the events must point to payload_size bytes, which the receiving slots get as their user data.
+ *        If the bridge is full, linvoke_emit sleeps until the receiving process makes space
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal whose events will be forwarded
+ * @param bridge Pointer to the bridge that will carry the events
+ * @param payload_size The number of bytes copied from the user data of each event. Together with its header, it must not exceed half of the bridge size
+ */
+void linvoke_bridge_forward(linvoke_s *const linvoke, const linvoke_signal signal_id, linvoke_bridge_s *const bridge, const uint32_t payload_size);
+
+/**
+ * @fn linvoke_bridge_reserve
+ * @brief Reserves space for an event with a payload of any size in a bridge. Works like linvoke_post_reserve,
+ *        and can be called from any number of threads in any number of processes at once
+ * @param bridge Pointer to a bridge
+ * @param signal_id The ID of the signal that will emit the event in the receiving process
+ * @param size The size of the payload in bytes
+ * @return A pointer to the payload of the event or NULL if the bridge is full or the payload can never fit
+ */
+void *linvoke_bridge_reserve(linvoke_bridge_s *const bridge, const linvoke_signal signal_id, const uint32_t size);
+
+/**
+ * @fn linvoke_bridge_commit
+ * @brief Publishes an event that was reserved with linvoke_bridge_reserve and wakes the receiving process if it is waiting
+ * @param bridge Pointer to the bridge in which the event was reserved
+ * @param payload The pointer that was returned by linvoke_bridge_reserve
+ */
+void linvoke_bridge_commit(linvoke_bridge_s *const bridge, void *const payload);
+
+/**
+ * @fn linvoke_bridge_wait
+ * @brief Sleeps until an event is committed to a bridge. Must be called from the receiving process,
+ *        which is the only process that may wait on and dispatch the bridge
+ * @param bridge Pointer to a bridge
+ * @param timeout The maximum time to sleep in milliseconds, or a negative value to sleep until an event arrives
+ * @return 1 if there are events to dispatch, 0 if the timeout expired
+ */
+int linvoke_bridge_wait(linvoke_bridge_s *const bridge, const int timeout);
+
+/**
+ * @fn linvoke_bridge_dispatch
+ * @brief Emits all events that were committed to a bridge before this call through a linvoke object,
+ *        in the order they were reserved, then wakes the processes that wait for space.
+ *        The slots receive a pointer to the payload inside the shared memory, which is only valid until the slot returns
+ * @param bridge Pointer to a bridge
+ * @param linvoke Pointer to the linvoke object that emits the events in the receiving process
+ * @return The number of dispatched events
+ */
+uint32_t linvoke_bridge_dispatch(linvoke_bridge_s *const bridge, linvoke_s *const linvoke);
+#endif
+
 /**
  * @fn linvoke_get_registered_signal_count
  * @brief Get the number of registered signals
@@ -108,3 +870,21 @@ linvoke_signal linvoke_event_get_signal_id(linvoke_event_s *const event);
  * @return The user data of the event
  */
 void *linvoke_event_get_user_data(linvoke_event_s *const event);
+
+/**
+ * @fn linvoke_event_get_type
+ * @brief Get the type of the user data of the event, as given to linvoke_emit_typed
+ * @return The type of the user data, or NULL if the event was not emitted with linvoke_emit_typed
+ */
+const void *linvoke_event_get_type(linvoke_event_s *const event);
+
+/**
+ * @fn linvoke_event_get_context
+ * @brief Get the context of the slot that is being called, as given to linvoke_connect_with_context
+ * @return The context of the slot, or NULL if the slot was connected without one
+ */
+void *linvoke_event_get_context(linvoke_event_s *const event);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,181 @@
+/**
+ * @file:      linvoke.hpp
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#pragma once
+
+#include "linvoke.h"
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace linvoke
+{
+    /**
+     * @class signal
+     * @brief Typed handle to a signal of a linvoke object. The handle does not own the signal,
+     *        which has to be registered with linvoke_register_signal before slots are connected to it.
+     *        The slots receive references to the objects given to emit, which are only copied if they have to be
+     *        converted to the types of the arguments, or are const while the arguments are not.
+     *        The events are emitted with linvoke_emit_typed, so the slots connected here ignore the events of typed
+     *        handles with other arguments and the events from anywhere else, like linvoke_emit, posted events,
+     *        replays, bridges and timers, without reading their user data
+     * @tparam Args The types of the arguments that are passed to the slots when an event is emitted
+     */
+    template<typename... Args>
+    class signal
+    {
+    public:
+        /**
+         * @brief The payload that is passed as the user data of an event emitted through this signal,
+         *        which holds references to the arguments of the event
+         */
+        using payload = std::tuple<Args &...>;
+
+        /**
+         * @class connection
+         * @brief A callable that is connected to a signal. The callable is stored inside the connection,
+         *        so connecting does not allocate any memory, and the connection is disconnected when it is destroyed.
+         *        The address of the connection is used as the context of the slot, so it can not be copied or moved.
+         *        A connection has to be destroyed before the linvoke object it is connected to. If the callable could
+         *        not be connected, the connection is empty and the callable is never called
+         * @tparam Callable The type of the callable, usually a lambda
+         */
+        template<typename Callable>
+        class connection
+        {
+        public:
+            /**
+             * @brief Connects a callable to a signal
+             * @param linvoke Pointer to a linvoke object
+             * @param signal_id The ID of the signal to which the callable will be connected
+             * @param callable The callable that will be called when an event is emitted
+             */
+            template<typename Function>
+            connection(linvoke_s *const linvoke, const linvoke_signal signal_id, Function &&callable) :
+                linvoke(linvoke),
+                signal_id(signal_id),
+                callable(std::forward<Function>(callable)),
+                connected(linvoke_connect_with_context(linvoke, signal_id, &connection::trampoline, this))
+            {
+            }
+
+            connection(const connection &) = delete;
+
+            connection &operator=(const connection &) = delete;
+
+            ~connection()
+            {
+                if (connected)
+                {
+                    linvoke_disconnect_with_context(linvoke, signal_id, &connection::trampoline, this);
+                }
+            }
+
+            /**
+             * @brief Checks if the callable was connected to the signal
+             */
+            explicit operator bool() const noexcept
+            {
+                return connected;
+            }
+
+        private:
+            /**
+             * @brief The slot that is connected for every connection of this callable type.
+             *        It recovers the connection from the context and, if the event has the type of the payload,
+             *        the arguments from the user data
+             */
+            static void trampoline(linvoke_event_s *event)
+            {
+                if (linvoke_event_get_type(event) != &payload_type)
+                {
+                    return;
+                }
+
+                connection *const self = static_cast<connection *>(linvoke_event_get_context(event));
+                std::apply(self->callable, *static_cast<const payload *>(linvoke_event_get_user_data(event)));
+            }
+
+            linvoke_s *const linvoke;
+            const linvoke_signal signal_id;
+            Callable callable;
+            const bool connected;
+        };
+
+        /**
+         * @brief Creates a typed handle to a signal
+         * @param linvoke Pointer to a linvoke object
+         * @param signal_id The ID of the signal
+         */
+        signal(linvoke_s *const linvoke, const linvoke_signal signal_id) :
+            linvoke(linvoke),
+            signal_id(signal_id)
+        {
+        }
+
+        /**
+         * @brief Connects a callable to the signal. The callable is called with the arguments of every emitted event
+         *        for as long as the returned connection exists
+         * @param callable The callable that will be called when an event is emitted, usually a lambda
+         * @return The connection that holds the callable
+         */
+        template<typename Callable>
+        [[nodiscard]] connection<std::decay_t<Callable>> connect(Callable &&callable) const
+        {
+            static_assert(std::is_invocable_v<std::decay_t<Callable> &, Args &...>, "The callable can not be called with the arguments of the signal");
+            return connection<std::decay_t<Callable>>(linvoke, signal_id, std::forward<Callable>(callable));
+        }
+
+        /**
+         * @brief Emits an event from the signal with the given arguments
+         * @param values The objects that will be passed to the connected slots as the arguments
+         */
+        template<typename... Values>
+        void emit(Values &&...values) const
+        {
+            static_assert(sizeof...(Values) == sizeof...(Args), "The number of values does not match the arguments of the signal");
+
+            // Values that can be referred to as the arguments are held by reference, the others are converted once
+            std::tuple<held_t<Args, Values>...> held(values...);
+            payload arguments = std::apply([](auto &...held_values) { return payload(held_values...); }, held);
+
+            linvoke_emit_typed(linvoke, signal_id, &arguments, &payload_type);
+        }
+
+        /**
+         * @brief Get the ID of the signal
+         * @return The ID of the signal
+         */
+        linvoke_signal id() const
+        {
+            return signal_id;
+        }
+
+    private:
+        /**
+         * @brief How emit holds a value for an argument: a reference if the value can be bound to the argument
+         *        without a temporary, otherwise a copy of the value converted to the type of the argument
+         */
+        template<typename Arg, typename Value>
+        using held_t = std::conditional_t<std::is_convertible_v<std::remove_reference_t<Value> *, std::remove_reference_t<Arg> *>,
+                                          std::remove_reference_t<Value> &,
+                                          std::remove_cv_t<std::remove_reference_t<Arg>>>;
+
+        /**
+         * @brief Every combination of arguments has its own type, whose address is given to linvoke_emit_typed
+         */
+        static constexpr char payload_type = 0;
+
+        linvoke_s *linvoke;
+        linvoke_signal signal_id;
+    };
+}
@@ -0,0 +1,449 @@
+/**
+ * @file:      linvoke_coro.hpp
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#pragma once
+
+#include "linvoke.h"
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <utility>
+
+namespace linvoke
+{
+    class next_awaiter;
+    class queued_executor;
+    class signal_waiters;
+
+    /**
+     * @struct event
+     * @brief The event that resumed a coroutine waiting on a signal
+     * @var signal_id The ID of the signal that emitted the event
+     * @var user_data The user data of the event. It is only guaranteed to be valid while the event is emitted,
+     *      so a coroutine resumed through a queued_executor must not use it unless the emitter keeps it alive
+     */
+    struct event
+    {
+        linvoke_signal signal_id;
+        void *user_data;
+    };
+
+    namespace detail
+    {
+        /**
+         * @class waiter_queue
+         * @brief Intrusive doubly linked list of suspended coroutines. The nodes are the awaiters, which live in the
+         *        coroutine frames, so parking a coroutine does not allocate any memory
+         */
+        class waiter_queue
+        {
+        public:
+            waiter_queue() = default;
+
+            waiter_queue(const waiter_queue &) = delete;
+
+            waiter_queue &operator=(const waiter_queue &) = delete;
+
+            /**
+             * @brief Appends an awaiter that is not in any queue
+             */
+            void push_back(next_awaiter *const awaiter) noexcept;
+
+            /**
+             * @brief Removes the first awaiter
+             * @return The awaiter, or nullptr if the queue is empty
+             */
+            next_awaiter *pop_front() noexcept;
+
+            /**
+             * @brief Removes an awaiter that is in this queue
+             */
+            void remove(next_awaiter *const awaiter) noexcept;
+
+            /**
+             * @brief Moves all awaiters of another queue to the end of this one
+             */
+            void take(waiter_queue &other) noexcept;
+
+            /**
+             * @brief Checks if the queue holds no awaiters
+             */
+            bool empty() const noexcept
+            {
+                return head == nullptr;
+            }
+
+        private:
+            next_awaiter *head = nullptr;
+            next_awaiter *tail = nullptr;
+        };
+    }
+
+    /**
+     * @class next_awaiter
+     * @brief Suspends a coroutine until the next event of a signal. Returned by linvoke::next and meant to be awaited
+     *        right away. If the coroutine is destroyed while it waits, the awaiter removes itself from the waiters
+     */
+    class next_awaiter
+    {
+    public:
+        /**
+         * @brief Creates an awaiter for the next event of a signal
+         * @param waiters The waiters of the signal
+         */
+        explicit next_awaiter(signal_waiters &waiters) noexcept :
+            waiters(waiters)
+        {
+        }
+
+        next_awaiter(const next_awaiter &) = delete;
+
+        next_awaiter &operator=(const next_awaiter &) = delete;
+
+        ~next_awaiter()
+        {
+            if (queue != nullptr)
+            {
+                queue->remove(this);
+            }
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(const std::coroutine_handle<> coroutine) noexcept;
+
+        event await_resume() const noexcept
+        {
+            return received;
+        }
+
+    private:
+        friend class detail::waiter_queue;
+        friend class queued_executor;
+        friend class signal_waiters;
+
+        signal_waiters &waiters;
+        std::coroutine_handle<> coroutine;
+        detail::waiter_queue *queue = nullptr;
+        next_awaiter *previous = nullptr;
+        next_awaiter *next = nullptr;
+        event received = {};
+    };
+
+    /**
+     * @class queued_executor
+     * @brief Collects the coroutines whose events were emitted, so they are resumed when run is called instead of
+     *        inside linvoke_emit. Useful when the slots of a signal must return before the waiting code continues
+     */
+    class queued_executor
+    {
+    public:
+        queued_executor() = default;
+
+        queued_executor(const queued_executor &) = delete;
+
+        queued_executor &operator=(const queued_executor &) = delete;
+
+        /**
+         * @brief Forgets the queued coroutines, which stay suspended
+         */
+        ~queued_executor()
+        {
+            while (ready.pop_front() != nullptr)
+            {
+            }
+        }
+
+        /**
+         * @brief Resumes the coroutines that were queued before the call, in the order their events were emitted.
+         *        Coroutines queued while it runs are resumed by the next call
+         * @return The number of resumed coroutines
+         */
+        std::size_t run()
+        {
+            detail::waiter_queue resumed;
+            resumed.take(ready);
+
+            std::size_t resumed_count = 0;
+
+            while (next_awaiter *const awaiter = resumed.pop_front())
+            {
+                awaiter->coroutine.resume();
+                ++resumed_count;
+            }
+
+            return resumed_count;
+        }
+
+        /**
+         * @brief Checks if no coroutines are queued
+         */
+        bool empty() const noexcept
+        {
+            return ready.empty();
+        }
+
+    private:
+        friend class signal_waiters;
+
+        detail::waiter_queue ready;
+    };
+
+    /**
+     * @class signal_waiters
+     * @brief The coroutines that wait for the next event of a signal. It connects one slot to the signal, which resumes
+     *        every coroutine that waited when the event was emitted, in the order they started waiting. Coroutines that
+     *        wait again while they are resumed wait for the event after it. The address is used as the context of the slot,
+     *        so it can not be copied or moved, and it has to be destroyed before the linvoke object it is connected to
+     */
+    class signal_waiters
+    {
+    public:
+        /**
+         * @brief Connects the waiters to a signal, which has to be registered. If the slot can not be connected,
+         *        the waiting coroutines are never resumed
+         * @param linvoke Pointer to a linvoke object
+         * @param signal_id The ID of the signal
+         * @param executor The executor that resumes the coroutines, or nullptr to resume them inside linvoke_emit
+         */
+        signal_waiters(linvoke_s *const linvoke, const linvoke_signal signal_id, queued_executor *const executor = nullptr) :
+            linvoke(linvoke),
+            signal_id(signal_id),
+            executor(executor),
+            connected(linvoke_connect_with_context(linvoke, signal_id, &signal_waiters::trampoline, this))
+        {
+        }
+
+        signal_waiters(const signal_waiters &) = delete;
+
+        signal_waiters &operator=(const signal_waiters &) = delete;
+
+        /**
+         * @brief Disconnects from the signal. Coroutines that still wait stay suspended
+         */
+        ~signal_waiters()
+        {
+            if (connected)
+            {
+                linvoke_disconnect_with_context(linvoke, signal_id, &signal_waiters::trampoline, this);
+            }
+
+            while (waiting.pop_front() != nullptr)
+            {
+            }
+        }
+
+        /**
+         * @brief Checks if no coroutine waits for the signal
+         */
+        bool empty() const noexcept
+        {
+            return waiting.empty();
+        }
+
+        /**
+         * @brief Get the ID of the signal
+         */
+        linvoke_signal id() const noexcept
+        {
+            return signal_id;
+        }
+
+    private:
+        friend class next_awaiter;
+
+        /**
+         * @brief The slot that resumes the waiting coroutines. The waiters are taken off the list first,
+         *        so coroutines that wait again are left for the next event
+         */
+        static void trampoline(linvoke_event_s *event)
+        {
+            signal_waiters *const self = static_cast<signal_waiters *>(linvoke_event_get_context(event));
+            const linvoke::event received = { linvoke_event_get_signal_id(event), linvoke_event_get_user_data(event) };
+
+            // A resumed coroutine may destroy the waiters, so nothing is read from them after the first resume
+            queued_executor *const executor = self->executor;
+            detail::waiter_queue resumed;
+            resumed.take(self->waiting);
+
+            while (next_awaiter *const awaiter = resumed.pop_front())
+            {
+                awaiter->received = received;
+
+                if (executor != nullptr)
+                {
+                    executor->ready.push_back(awaiter);
+                }
+                else
+                {
+                    awaiter->coroutine.resume();
+                }
+            }
+        }
+
+        linvoke_s *const linvoke;
+        const linvoke_signal signal_id;
+        queued_executor *const executor;
+        const bool connected;
+        detail::waiter_queue waiting;
+    };
+
+    /**
+     * @brief Waits for the next event of a signal: auto event = co_await linvoke::next(waiters);
+     * @param waiters The waiters of the signal
+     * @return The awaiter, which resumes with the event
+     */
+    inline next_awaiter next(signal_waiters &waiters) noexcept
+    {
+        return next_awaiter(waiters);
+    }
+
+    /**
+     * @class task
+     * @brief A coroutine that starts running right away and owns its frame, which is destroyed with the task.
+     *        Destroying a task that waits on a signal stops the wait
+     */
+    class task
+    {
+    public:
+        struct promise_type
+        {
+            task get_return_object() noexcept
+            {
+                return task(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_never initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            std::suspend_always final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void return_void() const noexcept
+            {
+            }
+
+            void unhandled_exception() const noexcept
+            {
+                std::terminate();
+            }
+        };
+
+        task(task &&other) noexcept :
+            coroutine(std::exchange(other.coroutine, nullptr))
+        {
+        }
+
+        task &operator=(task &&) = delete;
+
+        ~task()
+        {
+            if (coroutine)
+            {
+                coroutine.destroy();
+            }
+        }
+
+        /**
+         * @brief Checks if the coroutine ran to its end
+         */
+        bool done() const noexcept
+        {
+            return !coroutine || coroutine.done();
+        }
+
+    private:
+        explicit task(const std::coroutine_handle<promise_type> coroutine) noexcept :
+            coroutine(coroutine)
+        {
+        }
+
+        std::coroutine_handle<promise_type> coroutine;
+    };
+
+    inline void next_awaiter::await_suspend(const std::coroutine_handle<> coroutine) noexcept
+    {
+        this->coroutine = coroutine;
+        waiters.waiting.push_back(this);
+    }
+
+    inline void detail::waiter_queue::push_back(next_awaiter *const awaiter) noexcept
+    {
+        awaiter->queue = this;
+        awaiter->previous = tail;
+        awaiter->next = nullptr;
+
+        if (tail != nullptr)
+        {
+            tail->next = awaiter;
+        }
+        else
+        {
+            head = awaiter;
+        }
+
+        tail = awaiter;
+    }
+
+    inline next_awaiter *detail::waiter_queue::pop_front() noexcept
+    {
+        next_awaiter *const awaiter = head;
+
+        if (awaiter != nullptr)
+        {
+            remove(awaiter);
+        }
+
+        return awaiter;
+    }
+
+    inline void detail::waiter_queue::remove(next_awaiter *const awaiter) noexcept
+    {
+        if (awaiter->previous != nullptr)
+        {
+            awaiter->previous->next = awaiter->next;
+        }
+        else
+        {
+            head = awaiter->next;
+        }
+
+        if (awaiter->next != nullptr)
+        {
+            awaiter->next->previous = awaiter->previous;
+        }
+        else
+        {
+            tail = awaiter->previous;
+        }
+
+        awaiter->queue = nullptr;
+        awaiter->previous = nullptr;
+        awaiter->next = nullptr;
+    }
+
+    inline void detail::waiter_queue::take(waiter_queue &other) noexcept
+    {
+        // Every awaiter has to know its queue, so it can remove itself if its coroutine is destroyed
+        while (next_awaiter *const awaiter = other.pop_front())
+        {
+            push_back(awaiter);
+        }
+    }
+}
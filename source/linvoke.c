@@ -11,8 +11,25 @@
  */
 
 #include "../include/linvoke.h"
+#include "linvoke_intern.h"
+#include "linvoke_keyed.h"
+#include "linvoke_pool.h"
+#include "linvoke_profile.h"
+#include "linvoke_queue.h"
+#include "linvoke_record.h"
+#include "linvoke_ring.h"
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef LINVOKE_MAX_SIGNALS
+#include "linvoke_timer.h"
+#endif
 
 /**
  * @def LINVOKE_SIGNAL_ARRAY_BLOCK_SIZE
@@ -36,32 +53,172 @@
 #define LINVOKE_SLOT_ARRAY_BLOCK_SIZE 8
 #endif
 
+/**
+ * @def LINVOKE_SLOT_SET_THRESHOLD
+ * @brief The number of connected slots from which a signal keeps a hash set of its slots.
+ *        Below this number, duplicate connections are detected by scanning the slots array,
+ *        which is faster for small arrays and does not use any extra memory.
+ */
+#ifndef LINVOKE_SLOT_SET_THRESHOLD
+#define LINVOKE_SLOT_SET_THRESHOLD 32
+#endif
+
+/**
+ * @def LINVOKE_SIGNAL_INDEX_MINIMUM_CAPACITY
+ * @brief The initial capacity of the hash index that maps signal IDs to positions in the signal array.
+ *        The index always has a power of two capacity that is at least twice the number of registered signals.
+ */
+#ifndef LINVOKE_SIGNAL_INDEX_MINIMUM_CAPACITY
+#define LINVOKE_SIGNAL_INDEX_MINIMUM_CAPACITY 16
+#endif
+
+/**
+ * @def LINVOKE_POST_QUEUE_SIZE
+ * @brief The size of the post queue ring buffer in bytes. Must be a power of two.
+ *        The post queue is allocated once when the linvoke object is created and never grows,
+ *        so this is also the upper bound on the memory used by events that are waiting to be dispatched.
+ */
+#ifndef LINVOKE_POST_QUEUE_SIZE
+#define LINVOKE_POST_QUEUE_SIZE 65536
+#endif
+
+/**
+ * @def LINVOKE_POST_QUEUE_MEMORY_SIZE
+ * @brief The size of the memory block that holds the rings of all priority lanes of the post queue
+ */
+#define LINVOKE_POST_QUEUE_MEMORY_SIZE (LINVOKE_PRIORITY_COUNT * sizeof(linvoke_ring_s) + LINVOKE_POST_QUEUE_SIZE + (LINVOKE_PRIORITY_COUNT - 1) * LINVOKE_PRIORITY_LANE_SIZE)
+
+/**
+ * @def LINVOKE_PRIORITY_STARVATION_LIMIT
+ * @brief The number of dispatches in a row that can leave events in a priority lane before the lane is drained first
+ */
+#ifndef LINVOKE_PRIORITY_STARVATION_LIMIT
+#define LINVOKE_PRIORITY_STARVATION_LIMIT 4
+#endif
+
+/**
+ * @def LINVOKE_PARALLEL_THRESHOLD
+ * @brief The number of slots from which an event of a parallel signal is split across the worker pool.
+ *        Smaller fan-outs are emitted inline, since waking the workers would take longer than calling the slots.
+ */
+#ifndef LINVOKE_PARALLEL_THRESHOLD
+#define LINVOKE_PARALLEL_THRESHOLD 64
+#endif
+
+/**
+ * @def LINVOKE_PARALLEL_WORKER_COUNT
+ * @brief The number of worker threads that emit events of parallel signals together with the emitting thread.
+ *        0 uses one worker for every online processor except the one of the emitting thread.
+ */
+#ifndef LINVOKE_PARALLEL_WORKER_COUNT
+#define LINVOKE_PARALLEL_WORKER_COUNT 0
+#endif
+
+#ifdef LINVOKE_MAX_SIGNALS
+/**
+ * @def LINVOKE_STATIC_SIGNAL_INDEX_CAPACITY
+ * @brief The fixed capacity of the signal index in the static configuration. It is the smallest power of two
+ *        that is at least twice LINVOKE_MAX_SIGNALS, so the load factor of the index never exceeds one half.
+ *        The power of two is found by copying the highest set bit into all lower bits at compile time.
+ */
+#define LINVOKE_SPREAD_BITS_1(value) ((value) | ((value) >> 1))
+#define LINVOKE_SPREAD_BITS_2(value) (LINVOKE_SPREAD_BITS_1(value) | (LINVOKE_SPREAD_BITS_1(value) >> 2))
+#define LINVOKE_SPREAD_BITS_4(value) (LINVOKE_SPREAD_BITS_2(value) | (LINVOKE_SPREAD_BITS_2(value) >> 4))
+#define LINVOKE_SPREAD_BITS_8(value) (LINVOKE_SPREAD_BITS_4(value) | (LINVOKE_SPREAD_BITS_4(value) >> 8))
+#define LINVOKE_SPREAD_BITS_16(value) (LINVOKE_SPREAD_BITS_8(value) | (LINVOKE_SPREAD_BITS_8(value) >> 16))
+#define LINVOKE_STATIC_SIGNAL_INDEX_CAPACITY (LINVOKE_SPREAD_BITS_16(2u * LINVOKE_MAX_SIGNALS - 1) + 1)
+
+_Static_assert(LINVOKE_MAX_SIGNALS > 0 && LINVOKE_MAX_SIGNALS <= (1u << 30), "LINVOKE_MAX_SIGNALS must be between 1 and 2^30");
+_Static_assert(LINVOKE_MAX_SLOTS_PER_SIGNAL > 0, "LINVOKE_MAX_SLOTS_PER_SIGNAL must be at least 1");
+#endif
+
+/**
+ * @def LINVOKE_INDEX_EMPTY
+ * @brief Value of an entry in the signal index or a slot set that was never used
+ */
+#define LINVOKE_INDEX_EMPTY 0
+
+/**
+ * @def LINVOKE_INDEX_TOMBSTONE
+ * @brief Value of an entry in the signal index or a slot set whose signal or slot was removed.
+ *        Lookups probe past it, so the entries behind it stay reachable until the index is rebuilt
+ */
+#define LINVOKE_INDEX_TOMBSTONE UINT32_MAX
+
+/**
+ * @def LINVOKE_POST_NO_SIGNAL_SEQUENCE
+ * @brief Signal sequence number of a posted event whose signal had no queue limit when it was posted
+ */
+#define LINVOKE_POST_NO_SIGNAL_SEQUENCE UINT64_MAX
+
+_Static_assert((LINVOKE_SIGNAL_INDEX_MINIMUM_CAPACITY & (LINVOKE_SIGNAL_INDEX_MINIMUM_CAPACITY - 1)) == 0, "LINVOKE_SIGNAL_INDEX_MINIMUM_CAPACITY must be a power of two");
+_Static_assert((LINVOKE_POST_QUEUE_SIZE & (LINVOKE_POST_QUEUE_SIZE - 1)) == 0, "LINVOKE_POST_QUEUE_SIZE must be a power of two");
+_Static_assert((LINVOKE_PRIORITY_LANE_SIZE & (LINVOKE_PRIORITY_LANE_SIZE - 1)) == 0, "LINVOKE_PRIORITY_LANE_SIZE must be a power of two");
+_Static_assert(LINVOKE_PRIORITY_COUNT > 0, "LINVOKE_PRIORITY_COUNT must be at least 1");
+
 /**
  * @struct linvoke_event_s
  * @brief Structure that holds the data for an event
  * @var signal_id The ID of the signal that emitted the event
  * @var user_data The user data that was passed when the event was emitted
+ * @var type The type of the user data that was passed to linvoke_emit_typed, or NULL
+ * @var context The context of the slot that is currently being called
  */
 struct linvoke_event_s
 {
     linvoke_signal signal_id;
     void *user_data;
+    const void *type;
+    void *context;
 };
 
+/**
+ * @struct linvoke_slot_s
+ * @brief Structure that holds a slot connected to a signal
+ * @var function The function that will be called when an event is emitted. NULL for a disconnected slot
+ * @var context The context that was given when the slot was connected. NULL for slots connected without one
+ */
+typedef struct linvoke_slot_s
+{
+    linvoke_slot_pointer function;
+    void *context;
+} linvoke_slot_s;
+
 /**
  * @struct linvoke_signal_data_s
  * @brief Structure that holds information about a signal
  * @var id The ID of the signal
- * @var slots An array of pointers to slots that are connected to the signal
+ * @var registered Whether the signal is registered. Unregistered signals stay in the signals array until it is compacted
+ * @var parallel Whether the slots of the signal may be called from several threads at once
+ * @var recorded_payload_size The number of bytes of the user data that are copied into the event log for every event
+ * @var priority The priority lane that the posted events of the signal are queued in
+ * @var queue The limit and the counters of the posted events of the signal
+ * @var slots An array of slots that are connected to the signal. Disconnected slots are left with a NULL function
  * @var connected_slot_count The number of slots that are currently connected to the signal
+ * @var slot_array_length The number of used entries in the slots array, including the disconnected ones
  * @var slot_capacity The maximum capacity of the slots array
+ * @var slot_set Open addressing hash set of positions in the slots array, offset by one, used for duplicate detection
+ *      and disconnection. NULL until the number of slots reaches LINVOKE_SLOT_SET_THRESHOLD
+ * @var slot_set_capacity The number of entries in the slot set. Always a power of two
+ * @var keyed_slots The slots that are only called for the events emitted with their key
  */
 typedef struct linvoke_signal_data_s
 {
     linvoke_signal id;
-    linvoke_slot_pointer *slots;
+    bool registered;
+    bool parallel;
+    uint32_t recorded_payload_size;
+    uint32_t priority;
+    linvoke_queue_s queue;
+    linvoke_slot_s *slots;
     uint32_t connected_slot_count;
+    uint32_t slot_array_length;
     uint32_t slot_capacity;
+    uint32_t *slot_set;
+    uint32_t slot_set_capacity;
+#ifndef LINVOKE_MAX_SIGNALS
+    linvoke_keyed_table_s keyed_slots;
+#endif
 } linvoke_signal_data_s;
 
 /**
@@ -69,15 +226,129 @@ typedef struct linvoke_signal_data_s
  * @brief Structure that holds information about a linvoke object
  * @var signals An array of registered signals
  * @var registered_signal_count The number of signals that are registered within the linvoke object
+ * @var signal_array_length The number of used entries in the signals array, including the unregistered ones
  * @var signal_capacity The maximum capacity of the signals array
+ * @var signal_index Open addressing hash table of positions in the signals array, offset by one
+ * @var signal_index_capacity The number of entries in the signal index. Always a power of two
+ * @var pool The worker threads that emit events of parallel signals. NULL until the first signal is made parallel
+ * @var profiler The samples of the slot calls. NULL until profiling is started for the first time
+ * @var profile_rate Every how many emitted events the slot calls are sampled, or 0 if profiling is off
+ * @var profile_countdown The number of events that are emitted before the next sampled event. Only the emitting thread
+ *      counts it down, but setting the rate restarts it from any thread
+ * @var interner The names of the named signals and their IDs
+ * @var next_named_signal_id The ID of the next name that is interned
+ * @var serial A number that no other linvoke object of the process has, so named signals know which object they were resolved in
+ * @var timers The delayed and periodic emissions
+ * @var post_queues The rings of events that were posted, but not yet dispatched, one for every priority lane.
+ *      They share one memory block, which starts with the ring of lane 0
+ * @var starved_dispatch_counts The number of dispatches in a row that left events in each priority lane
+ * @var wakeup_fd The eventfd that becomes readable when events are pending, or -1 if linvoke_get_fd was never called
+ * @var wakeup_pending Whether the eventfd was signaled since the last dispatch, so producers only signal it once per drain
+ * @var queue The limit and the counters of the post queue
+ * @var posting_lock Held by a producer while it reserves a record and admits its event
+ * @var limited_signal_count The number of signals with a queue limit, so producers only look signals up if there are any
+ * @var prioritized_signal_count The number of signals with a priority above 0, for the same reason
+ * @var release_sequence Futex word that a dispatch changes when it made room for blocked producers
+ * @var blocked_producer_count The number of producers that wait for room, so a dispatch only wakes them if there are any
+ * @var recorder The event log that every emitted event is appended to while recording
+ * @var signal_storage The signals array in the static configuration
+ * @var slot_storage The slots arrays in the static configuration. Each position of the signals array owns one row
+ * @var signal_index_storage The signal index in the static configuration
+ * @var post_queue_storage The rings of the post queue in the static configuration
  */
 struct linvoke_s
 {
     linvoke_signal_data_s *signals;
     uint32_t registered_signal_count;
+    uint32_t signal_array_length;
     uint32_t signal_capacity;
+    uint32_t *signal_index;
+    uint32_t signal_index_capacity;
+#ifndef LINVOKE_MAX_SIGNALS
+    linvoke_pool_s *pool;
+    linvoke_profiler_s *profiler;
+    _Atomic uint32_t profile_rate;
+    _Atomic uint32_t profile_countdown;
+    linvoke_interner_s interner;
+    linvoke_signal next_named_signal_id;
+    uint64_t serial;
+    linvoke_timer_wheel_s timers;
+#endif
+    linvoke_ring_s *post_queues[LINVOKE_PRIORITY_COUNT];
+    uint32_t starved_dispatch_counts[LINVOKE_PRIORITY_COUNT];
+    _Alignas(LINVOKE_CACHE_LINE_SIZE) _Atomic int wakeup_fd;
+    _Atomic bool wakeup_pending;
+    linvoke_queue_s queue;
+    atomic_flag posting_lock;
+    _Atomic uint32_t limited_signal_count;
+    _Atomic uint32_t prioritized_signal_count;
+    _Atomic uint32_t release_sequence;
+    _Atomic uint32_t blocked_producer_count;
+    linvoke_recorder_s recorder;
+#ifdef LINVOKE_MAX_SIGNALS
+    linvoke_signal_data_s signal_storage[LINVOKE_MAX_SIGNALS];
+    linvoke_slot_s slot_storage[LINVOKE_MAX_SIGNALS][LINVOKE_MAX_SLOTS_PER_SIGNAL];
+    uint32_t signal_index_storage[LINVOKE_STATIC_SIGNAL_INDEX_CAPACITY];
+    _Alignas(LINVOKE_CACHE_LINE_SIZE) uint8_t post_queue_storage[LINVOKE_POST_QUEUE_MEMORY_SIZE];
+#endif
 };
 
+/**
+ * @brief The number of slots arrays that are being walked on the current thread. A slots array is only compacted when
+ *        a slot is connected while this is 0, since an emission further up the stack may be walking the array
+ */
+static _Thread_local uint32_t linvoke_emission_depth = 0;
+
+#ifndef LINVOKE_MAX_SIGNALS
+/**
+ * @brief The serial number of the next linvoke object that is created. Starts at 1, since 0 marks unresolved named signals
+ */
+static _Atomic uint64_t linvoke_next_serial = 1;
+#endif
+
+#ifdef LINVOKE_MAX_SIGNALS
+_Static_assert(sizeof(linvoke_s) <= sizeof(linvoke_storage_s), "LINVOKE_STORAGE_SIZE is too small for the linvoke object");
+_Static_assert(_Alignof(linvoke_s) <= _Alignof(linvoke_storage_s), "The linvoke storage is not aligned enough for the linvoke object");
+#endif
+
+/**
+ * @struct linvoke_parallel_emission_s
+ * @brief The event of a parallel signal that is being emitted by the worker pool
+ * @var signal The signal that emits the event
+ * @var user_data The user data of the event
+ * @var type The type of the user data, or NULL
+ */
+typedef struct linvoke_parallel_emission_s
+{
+    const linvoke_signal_data_s *signal;
+    void *user_data;
+    const void *type;
+} linvoke_parallel_emission_s;
+
+/**
+ * @struct linvoke_post_header_s
+ * @brief Header that precedes the payload of every event in the post queue
+ * @var sequence The sequence number of the event in the queue of the linvoke object
+ * @var signal_sequence The sequence number of the event in the queue of its signal, or LINVOKE_POST_NO_SIGNAL_SEQUENCE
+ */
+typedef struct linvoke_post_header_s
+{
+    uint64_t sequence;
+    uint64_t signal_sequence;
+} linvoke_post_header_s;
+
+/**
+ * @struct linvoke_post_block_s
+ * @brief The state of a producer that waits for room in a full queue
+ * @var start_time The time at which the producer started waiting, or 0 if it is not waiting
+ * @var release_sequence The release sequence of the linvoke object before the last attempt to make room
+ */
+typedef struct linvoke_post_block_s
+{
+    uint64_t start_time;
+    uint32_t release_sequence;
+} linvoke_post_block_s;
+
 /**
  * @brief Finds a signal with a given ID if it exists
  * @param linvoke Pointer to a linvoke object
@@ -86,9 +357,307 @@ struct linvoke_s
  */
 linvoke_signal_data_s *linvoke_find_signal(linvoke_s *const linvoke, const linvoke_signal signal_id);
 
+/**
+ * @brief Finds the entry of the signal index that refers to a signal with a given ID
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal to find
+ * @return A pointer to the index entry or NULL if no such signal is registered
+ */
+static uint32_t *linvoke_find_signal_index_entry(linvoke_s *const linvoke, const linvoke_signal signal_id);
+
+/**
+ * @brief Adds a signal that is already stored in the signals array to the signal index
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_position The position of the signal in the signals array
+ */
+static void linvoke_signal_index_insert(linvoke_s *const linvoke, const uint32_t signal_position);
+
+#ifndef LINVOKE_MAX_SIGNALS
+/**
+ * @brief Replaces the signal index with a new one of a given capacity, filled with the registered signals
+ * @param linvoke Pointer to a linvoke object
+ * @param capacity The number of entries in the new index. Must be a power of two
+ * @return true if the index was rebuilt, false if the memory could not be allocated
+ */
+static bool linvoke_rebuild_signal_index(linvoke_s *const linvoke, const uint32_t capacity);
+#endif
+
+/**
+ * @brief Makes sure that the signals array and the signal index can hold a given number of signals,
+ *        reallocating them at most once
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_count The number of entries the signals array should be able to hold, including the unregistered ones
+ * @return true if there is enough space for the signals, false if the memory could not be reallocated
+ */
+static bool linvoke_reserve_signals(linvoke_s *const linvoke, const uint32_t signal_count);
+
+/**
+ * @brief Registers a signal at the end of the signals array. The caller has to make sure there is enough space for it
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal that will be registered
+ */
+static void linvoke_append_signal(linvoke_s *const linvoke, const linvoke_signal signal_id);
+
+/**
+ * @brief Makes sure that the slots array of a signal can hold a given number of slots, reallocating it at most once.
+ *        Creates or grows the slot set of the signal as well, once the number of slots reaches LINVOKE_SLOT_SET_THRESHOLD
+ * @param signal Pointer to the signal
+ * @param slot_count The number of entries the slots array should be able to hold, including the disconnected ones
+ * @return true if there is enough space for the slots, false if the memory could not be reallocated
+ */
+static bool linvoke_reserve_slots(linvoke_signal_data_s *const signal, const uint32_t slot_count);
+
+/**
+ * @brief Compacts the slots array of a signal before a number of slots is connected, if the slots would not fit
+ *        and at least half of the array is taken by disconnected slots. Skipped while the thread is walking a slots array
+ * @param signal Pointer to the signal
+ * @param slot_count The number of slots that will be connected
+ */
+static void linvoke_reuse_disconnected_slots(linvoke_signal_data_s *const signal, const uint32_t slot_count);
+
+/**
+ * @brief Appends a slot to the slots array of a signal. The caller has to make sure there is enough space for it
+ * @param signal Pointer to the signal
+ * @param slot The slot that will be connected
+ */
+static void linvoke_append_slot(linvoke_signal_data_s *const signal, const linvoke_slot_s slot);
+
+/**
+ * @brief Finds the position of a slot in the slots array of a signal, using the slot set of the signal if it has one
+ * @param signal Pointer to the signal
+ * @param slot The slot to look for
+ * @return The position of the slot or UINT32_MAX if the slot is not connected to the signal
+ */
+static uint32_t linvoke_find_slot(const linvoke_signal_data_s *const signal, const linvoke_slot_s slot);
+
+/**
+ * @brief Finds the entry of the slot set of a signal that refers to a given slot
+ * @param signal Pointer to the signal, which must have a slot set
+ * @param slot The slot to look for
+ * @return A pointer to the slot set entry or NULL if the slot is not connected to the signal
+ */
+static uint32_t *linvoke_find_slot_set_entry(const linvoke_signal_data_s *const signal, const linvoke_slot_s slot);
+
+/**
+ * @brief Adds a slot that is already stored in the slots array of a signal to the slot set of the signal
+ * @param signal Pointer to the signal, which must have a slot set
+ * @param slot_position The position of the slot in the slots array
+ */
+static void linvoke_slot_set_insert(linvoke_signal_data_s *const signal, const uint32_t slot_position);
+
+#ifndef LINVOKE_MAX_SIGNALS
+/**
+ * @brief Replaces the slot set of a signal with a new one of a given capacity, filled with the connected slots
+ * @param signal Pointer to the signal
+ * @param capacity The number of entries in the new slot set. Must be a power of two, or 0 to remove the slot set
+ * @return true if the slot set was rebuilt, false if the memory could not be allocated
+ */
+static bool linvoke_rebuild_slot_set(linvoke_signal_data_s *const signal, const uint32_t capacity);
+#endif
+
+/**
+ * @brief Removes the disconnected slots from the slots array of a signal and returns the unused memory to the allocator
+ * @param signal Pointer to the signal
+ */
+static void linvoke_compact_slots(linvoke_signal_data_s *const signal);
+
+/**
+ * @brief Emits an event from a signal to its unkeyed slots, recording and profiling it if enabled
+ * @param linvoke Pointer to a linvoke object
+ * @param signal Pointer to the signal
+ * @param user_data The user data of the event
+ * @param type The type of the user data, or NULL
+ */
+static void linvoke_emit_signal(linvoke_s *const linvoke, linvoke_signal_data_s *const signal, void *const user_data, const void *const type);
+
+/**
+ * @brief Calls the slots in a range of the slots array of a signal. Disconnected slots are skipped
+ * @param signal Pointer to the signal
+ * @param user_data The user data of the event
+ * @param type The type of the user data, or NULL
+ * @param begin The position of the first slot to call
+ * @param end The position after the last slot to call
+ */
+static void linvoke_call_slots(const linvoke_signal_data_s *const signal, void *const user_data, const void *const type, const uint32_t begin, const uint32_t end);
+
+#ifndef LINVOKE_MAX_SIGNALS
+/**
+ * @brief Calls a range of the slots of a parallel emission. Runs on the worker threads and the emitting thread
+ * @param context Pointer to the linvoke_parallel_emission_s of the emission
+ * @param begin The position of the first slot to call
+ * @param end The position after the last slot to call
+ */
+static void linvoke_call_parallel_slots(void *context, const uint32_t begin, const uint32_t end);
+
+/**
+ * @brief Calls every slot of a signal and adds the duration of each call to the profiler
+ * @param linvoke Pointer to a linvoke object with a profiler
+ * @param signal Pointer to the signal
+ * @param user_data The user data of the event
+ * @param type The type of the user data, or NULL
+ * @param rate The rate at which the event was sampled, which is the number of calls each sample stands for
+ */
+static void linvoke_call_profiled_slots(linvoke_s *const linvoke, const linvoke_signal_data_s *const signal, void *const user_data, const void *const type, const uint32_t rate);
+
+/**
+ * @brief Emits the event of an expired timer
+ * @param context Pointer to the linvoke object
+ * @param signal_id The signal of the timer
+ * @param user_data The user data of the timer
+ */
+static void linvoke_emit_timer(void *context, const linvoke_signal signal_id, void *user_data);
+#endif
+
+/**
+ * @brief Initializes the rings of the priority lanes of the post queue in one memory block
+ * @param linvoke Pointer to a linvoke object
+ * @param memory The memory block, which is LINVOKE_POST_QUEUE_MEMORY_SIZE bytes long
+ */
+static void linvoke_init_post_queues(linvoke_s *const linvoke, uint8_t *const memory);
+
+/**
+ * @brief Checks if any priority lane of the post queue holds events that were not dispatched yet
+ * @param linvoke Pointer to a linvoke object
+ * @return true if there are pending events, false otherwise
+ */
+static bool linvoke_has_pending_events(linvoke_s *const linvoke);
+
+/**
+ * @brief Reserves space for an event in the post queue, applying the queue limits of the linvoke object and of the signal
+ * @param linvoke Pointer to a linvoke object
+ * @param signal_id The ID of the signal which will emit the event
+ * @param size The size of the payload in bytes
+ * @param status Receives the outcome of the post
+ * @return Pointer to the payload of the event or NULL if the event was dropped or can never fit
+ */
+static void *linvoke_post_reserve_with_status(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint32_t size, linvoke_post_status *const status);
+
+/**
+ * @brief Waits until no other producer of a linvoke object is reserving a record in its post queue
+ * @param linvoke Pointer to a linvoke object
+ */
+static void linvoke_lock_posting(linvoke_s *const linvoke);
+
+/**
+ * @brief Lets the next producer of a linvoke object reserve a record
+ * @param linvoke Pointer to a linvoke object
+ */
+static void linvoke_unlock_posting(linvoke_s *const linvoke);
+
+/**
+ * @brief Called every time a producer failed to make room in a full queue, after which it tries again.
+ *        The first call registers the producer as blocked, every following call sleeps until a dispatch made room
+ * @param linvoke Pointer to a linvoke object
+ * @param block Pointer to the state of the producer, which starts zeroed
+ */
+static void linvoke_wait_for_room(linvoke_s *const linvoke, linvoke_post_block_s *const block);
+
+/**
+ * @brief Unregisters a producer that was blocked and counts the time it waited
+ * @param linvoke Pointer to a linvoke object
+ * @param block Pointer to the state of the producer
+ * @param queue Pointer to the queue that was full
+ */
+static void linvoke_stop_waiting_for_room(linvoke_s *const linvoke, const linvoke_post_block_s *const block, linvoke_queue_s *const queue);
+
+/**
+ * @brief Ring consumer that emits an event of the post queue, unless the event was dropped while it was pending
+ * @param context Pointer to the linvoke object
+ * @param signal_id The ID of the signal that emits the event
+ * @param payload The record payload, which starts with a linvoke_post_header_s
+ * @return true if the event was emitted, false if it was dropped
+ */
+static bool linvoke_dispatch_record(void *context, const linvoke_signal signal_id, void *payload);
+
+/**
+ * @brief Get the time of the monotonic clock
+ * @return The time in nanoseconds
+ */
+static uint64_t linvoke_get_monotonic_time(void);
+
+/**
+ * @brief Hashes a signal ID for the signal index
+ * @param signal_id The ID of the signal
+ * @return The hash of the signal ID
+ */
+static uint32_t linvoke_hash_signal_id(const linvoke_signal signal_id);
+
+/**
+ * @brief Hashes a slot for slot sets
+ * @param slot The slot
+ * @return The hash of the slot function and context
+ */
+static uint32_t linvoke_hash_slot(const linvoke_slot_s slot);
+
+/**
+ * @brief Checks if two slots have the same function and context
+ * @param first The first slot
+ * @param second The second slot
+ * @return true if the slots are the same, false otherwise
+ */
+static bool linvoke_is_same_slot(const linvoke_slot_s first, const linvoke_slot_s second);
+
+#ifndef LINVOKE_MAX_SIGNALS
+/**
+ * @brief Rounds a value up to a multiple of a block size
+ * @param value The value to round up
+ * @param block_size The block size
+ * @return The rounded up value
+ */
+static uint32_t linvoke_round_up_to_block_size(const uint32_t value, const uint32_t block_size);
+
+/**
+ * @brief Calculates the smallest power of two that is not smaller than a given value
+ * @param value The value to round up
+ * @return The rounded up value
+ */
+static uint32_t linvoke_round_up_to_power_of_two(const uint32_t value);
+#endif
+
+#ifdef LINVOKE_MAX_SIGNALS
+linvoke_s *linvoke_init(linvoke_storage_s *const storage)
+{
+    // Every array lives inside the storage, so the linvoke object never allocates memory
+    linvoke_s *const linvoke = (linvoke_s *) storage;
+
+    linvoke->signals = linvoke->signal_storage;
+    linvoke->signal_index = linvoke->signal_index_storage;
+    memset(linvoke->signal_index, 0, sizeof(linvoke->signal_index_storage));
+
+    linvoke_init_post_queues(linvoke, linvoke->post_queue_storage);
+    atomic_init(&linvoke->wakeup_fd, -1);
+    atomic_init(&linvoke->wakeup_pending, false);
+    linvoke_queue_init(&linvoke->queue);
+    atomic_flag_clear(&linvoke->posting_lock);
+    atomic_init(&linvoke->limited_signal_count, 0);
+    atomic_init(&linvoke->prioritized_signal_count, 0);
+    atomic_init(&linvoke->release_sequence, 0);
+    atomic_init(&linvoke->blocked_producer_count, 0);
+    linvoke_recorder_init(&linvoke->recorder);
+
+    linvoke->registered_signal_count = 0;
+    linvoke->signal_array_length = 0;
+    linvoke->signal_capacity = LINVOKE_MAX_SIGNALS;
+    linvoke->signal_index_capacity = LINVOKE_STATIC_SIGNAL_INDEX_CAPACITY;
+
+    return linvoke;
+}
+
+void linvoke_destroy(linvoke_s *const linvoke)
+{
+    linvoke_recorder_close(&linvoke->recorder);
+
+    // The storage belongs to the caller, so only the eventfd and the event log have to be released
+    if (atomic_load(&linvoke->wakeup_fd) >= 0)
+    {
+        close(atomic_load(&linvoke->wakeup_fd));
+    }
+}
+#else
 linvoke_s *linvoke_create(void)
 {
-    linvoke_s *linvoke = malloc(sizeof(*linvoke));
+    // The wakeup state is cache line aligned, so the object needs the same alignment
+    linvoke_s *linvoke = aligned_alloc(_Alignof(linvoke_s), sizeof(*linvoke));
 
     if (linvoke == NULL)
     {
@@ -105,25 +674,101 @@ linvoke_s *linvoke_create(void)
         return NULL;
     }
 
+    uint8_t *const post_queue_memory = aligned_alloc(_Alignof(linvoke_ring_s), LINVOKE_POST_QUEUE_MEMORY_SIZE);
+
+    if (post_queue_memory == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the linvoke post queue.\n");
+        free(linvoke->signals);
+        free(linvoke);
+        return NULL;
+    }
+
+    linvoke_init_post_queues(linvoke, post_queue_memory);
+    atomic_init(&linvoke->wakeup_fd, -1);
+    atomic_init(&linvoke->wakeup_pending, false);
+    linvoke_queue_init(&linvoke->queue);
+    atomic_flag_clear(&linvoke->posting_lock);
+    atomic_init(&linvoke->limited_signal_count, 0);
+    atomic_init(&linvoke->prioritized_signal_count, 0);
+    atomic_init(&linvoke->release_sequence, 0);
+    atomic_init(&linvoke->blocked_producer_count, 0);
+    linvoke_recorder_init(&linvoke->recorder);
+
+    linvoke->signal_index = calloc(LINVOKE_SIGNAL_INDEX_MINIMUM_CAPACITY, sizeof(*linvoke->signal_index));
+
+    if (linvoke->signal_index == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the linvoke signal index.\n");
+        free(linvoke->post_queues[0]);
+        free(linvoke->signals);
+        free(linvoke);
+        return NULL;
+    }
+
+    linvoke->pool = NULL;
+    linvoke->profiler = NULL;
+    atomic_init(&linvoke->profile_rate, 0);
+    atomic_init(&linvoke->profile_countdown, 0);
+    linvoke_interner_init(&linvoke->interner);
+    linvoke->next_named_signal_id = LINVOKE_NAMED_SIGNAL_ID_BASE;
+    linvoke->serial = atomic_fetch_add_explicit(&linvoke_next_serial, 1, memory_order_relaxed);
+    linvoke_timer_wheel_init(&linvoke->timers);
     linvoke->registered_signal_count = 0;
+    linvoke->signal_array_length = 0;
     linvoke->signal_capacity = LINVOKE_SIGNAL_ARRAY_BLOCK_SIZE;
+    linvoke->signal_index_capacity = LINVOKE_SIGNAL_INDEX_MINIMUM_CAPACITY;
 
     return linvoke;
 }
 
 void linvoke_destroy(linvoke_s *const linvoke)
 {
-    for (uint32_t i = 0; i < linvoke->registered_signal_count; ++i)
+    for (uint32_t i = 0; i < linvoke->signal_array_length; ++i)
     {
+        free(linvoke->signals[i].slot_set);
         free(linvoke->signals[i].slots);
+        linvoke_keyed_free(&linvoke->signals[i].keyed_slots);
+    }
+
+    if (atomic_load(&linvoke->wakeup_fd) >= 0)
+    {
+        close(atomic_load(&linvoke->wakeup_fd));
+    }
+
+    linvoke_recorder_close(&linvoke->recorder);
+
+    if (linvoke->pool != NULL)
+    {
+        linvoke_pool_destroy(linvoke->pool);
+    }
+
+    if (linvoke->profiler != NULL)
+    {
+        linvoke_profiler_destroy(linvoke->profiler);
     }
 
+    linvoke_interner_free(&linvoke->interner);
+    linvoke_timer_wheel_free(&linvoke->timers);
+
+    free(linvoke->signal_index);
+    free(linvoke->post_queues[0]);
     free(linvoke->signals);
     free(linvoke);
 }
+#endif
 
 void linvoke_register_signal(linvoke_s *const linvoke, const linvoke_signal signal_id)
 {
+#ifndef LINVOKE_MAX_SIGNALS
+    // The IDs from LINVOKE_NAMED_SIGNAL_ID_BASE on belong to the names, even while their signals are unregistered
+    if (signal_id >= LINVOKE_NAMED_SIGNAL_ID_BASE)
+    {
+        fprintf(stderr, "The signal id %u is reserved for named signals.\n", signal_id);
+        return;
+    }
+#endif
+
     // Check if there is an existing signal with the same ID
     if (linvoke_find_signal(linvoke, signal_id) != NULL)
     {
@@ -131,79 +776,301 @@ void linvoke_register_signal(linvoke_s *const linvoke, const linvoke_signal sign
         return;
     }
 
-    // Reallocate the signals array memory if the capacity is full
-    if (linvoke->registered_signal_count == linvoke->signal_capacity)
+    // Reallocate the signals array and the signal index if the capacity is full
+    if (!linvoke_reserve_signals(linvoke, linvoke->signal_array_length + 1))
     {
-        linvoke->signal_capacity += LINVOKE_SIGNAL_ARRAY_BLOCK_SIZE;
-        linvoke_signal_data_s *reallocated_signals = realloc(linvoke->signals, linvoke->signal_capacity * sizeof(*linvoke->signals));
-
-        if (reallocated_signals == NULL)
-        {
-            fprintf(stderr, "Failed to reallocate memory for the signals array.\n");
-            return;
-        }
-
-        linvoke->signals = reallocated_signals;
+        return;
     }
 
     // Register the new signal
-    linvoke_signal_data_s *const signal = &linvoke->signals[linvoke->registered_signal_count];
-    signal->id = signal_id;
-    signal->connected_slot_count = 0;
-    signal->slot_capacity = LINVOKE_SLOT_ARRAY_BLOCK_SIZE;
-    signal->slots = malloc(LINVOKE_SLOT_ARRAY_BLOCK_SIZE * sizeof(*signal->slots));
+    linvoke_append_signal(linvoke, signal_id);
+}
 
-    if (signal->slots == NULL)
+void linvoke_register_signals(linvoke_s *const linvoke, const linvoke_signal *const signal_ids, const uint32_t signal_count)
+{
+    // Make room for all signals up front, so the arrays are reallocated at most once
+    if (!linvoke_reserve_signals(linvoke, linvoke->signal_array_length + signal_count))
     {
-        fprintf(stderr, "Failed to allocate memory for the signal slots.\n");
         return;
     }
 
-    ++linvoke->registered_signal_count;
+    for (uint32_t i = 0; i < signal_count; ++i)
+    {
+#ifndef LINVOKE_MAX_SIGNALS
+        if (signal_ids[i] >= LINVOKE_NAMED_SIGNAL_ID_BASE)
+        {
+            fprintf(stderr, "The signal id %u is reserved for named signals.\n", signal_ids[i]);
+            continue;
+        }
+#endif
+
+        // Every registered signal is added to the index right away, so this
+        // also catches duplicates within the given signal IDs in the same pass
+        if (linvoke_find_signal(linvoke, signal_ids[i]) != NULL)
+        {
+            fprintf(stderr, "A signal with id %u already exists.\n", signal_ids[i]);
+            continue;
+        }
+
+        linvoke_append_signal(linvoke, signal_ids[i]);
+    }
 }
 
 void linvoke_connect(linvoke_s *const linvoke, const linvoke_signal signal_id, linvoke_slot_pointer slot)
 {
-    // Find the signal with the given ID
+    linvoke_connect_with_context(linvoke, signal_id, slot, NULL);
+}
+
+bool linvoke_connect_with_context(linvoke_s *const linvoke, const linvoke_signal signal_id, linvoke_slot_pointer slot, void *context)
+{
+    // Find the signal with the given ID
     linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
 
     // Signal not found
     if (signal == NULL)
     {
         fprintf(stderr, "A signal with id %u does not exist.\n", signal_id);
-        return;
+        return false;
     }
 
+    const linvoke_slot_s connected_slot = { .function = slot, .context = context };
+
     // Check if the callback is already connected
-    for (uint32_t j = 0; j < signal->connected_slot_count; ++j)
+    if (linvoke_find_slot(signal, connected_slot) != UINT32_MAX)
+    {
+        fprintf(stderr, "The callback function is already connected to signal %d\n", signal_id);
+        return false;
+    }
+
+    // Reallocate the slots array memory if the capacity is full and it can not be compacted instead
+    linvoke_reuse_disconnected_slots(signal, 1);
+
+    if (!linvoke_reserve_slots(signal, signal->slot_array_length + 1))
+    {
+        return false;
+    }
+
+    // Connect the slot
+    linvoke_append_slot(signal, connected_slot);
+
+    return true;
+}
+
+void linvoke_connect_many(linvoke_s *const linvoke, const linvoke_signal signal_id, const linvoke_slot_pointer *const slots, const uint32_t slot_count)
+{
+    // Find the signal with the given ID
+    linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
+
+    // Signal not found
+    if (signal == NULL)
+    {
+        fprintf(stderr, "A signal with id %u does not exist.\n", signal_id);
+        return;
+    }
+
+    linvoke_reuse_disconnected_slots(signal, slot_count);
+
+    // Make room for all slots up front, so the slots array and the slot set are reallocated at most once.
+    // If the signal ends up with enough slots to need a slot set, every duplicate check below is a hash lookup
+    if (!linvoke_reserve_slots(signal, signal->slot_array_length + slot_count))
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < slot_count; ++i)
     {
-        if (signal->slots[j] == slot)
+        const linvoke_slot_s connected_slot = { .function = slots[i], .context = NULL };
+
+        // Every connected slot is added to the slot set right away, so this
+        // also catches duplicates within the given slots in the same pass
+        if (linvoke_find_slot(signal, connected_slot) != UINT32_MAX)
         {
             fprintf(stderr, "The callback function is already connected to signal %d\n", signal_id);
-            return;
+            continue;
         }
+
+        // Connect the slot
+        linvoke_append_slot(signal, connected_slot);
     }
+}
+
+void linvoke_disconnect(linvoke_s *const linvoke, const linvoke_signal signal_id, linvoke_slot_pointer slot)
+{
+    linvoke_disconnect_with_context(linvoke, signal_id, slot, NULL);
+}
 
-    // Reallocate the slots array memory if the capacity is full
-    if (signal->connected_slot_count == signal->slot_capacity)
+void linvoke_disconnect_with_context(linvoke_s *const linvoke, const linvoke_signal signal_id, linvoke_slot_pointer slot, void *context)
+{
+    // Find the signal with the given ID
+    linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
+
+    // Signal not found
+    if (signal == NULL)
     {
-        signal->slot_capacity += LINVOKE_SLOT_ARRAY_BLOCK_SIZE;
+        fprintf(stderr, "A signal with id %u does not exist.\n", signal_id);
+        return;
+    }
 
-        linvoke_slot_pointer *reallocated_slots = realloc(signal->slots, signal->slot_capacity * sizeof(*signal->slots));
+    const linvoke_slot_s disconnected_slot = { .function = slot, .context = context };
+    uint32_t slot_position = UINT32_MAX;
 
-        if (reallocated_slots == NULL)
+    // With a slot set, the position is found in constant time and the set entry is turned into a tombstone
+    if (signal->slot_set != NULL)
+    {
+        uint32_t *const entry = linvoke_find_slot_set_entry(signal, disconnected_slot);
+
+        if (entry != NULL)
         {
-            fprintf(stderr, "Failed to reallocate memory for the slots array.\n");
-            return;
+            slot_position = *entry - 1;
+            *entry = LINVOKE_INDEX_TOMBSTONE;
         }
+    }
+    else
+    {
+        slot_position = linvoke_find_slot(signal, disconnected_slot);
+    }
 
-        signal->slots = reallocated_slots;
+    // Slot not connected
+    if (slot_position == UINT32_MAX)
+    {
+        fprintf(stderr, "The callback function is not connected to signal %u\n", signal_id);
+        return;
     }
 
-    // Connect the slot
-    signal->slots[signal->connected_slot_count] = slot;
+    // Leave a tombstone in the slots array, so the order of the other slots is kept and emitting can skip it
+    signal->slots[slot_position].function = NULL;
 
-    ++signal->connected_slot_count;
+    --signal->connected_slot_count;
+}
+
+void linvoke_unregister_signal(linvoke_s *const linvoke, const linvoke_signal signal_id)
+{
+    uint32_t *const entry = linvoke_find_signal_index_entry(linvoke, signal_id);
+
+    // Signal not found
+    if (entry == NULL)
+    {
+        fprintf(stderr, "A signal with id %u does not exist.\n", signal_id);
+        return;
+    }
+
+    linvoke_signal_data_s *const signal = &linvoke->signals[*entry - 1];
+
+    // The signal stays in the signals array until it is compacted. Its slots are freed then as well, since one of them
+    // may be unregistering the signal while an emission is still walking the slots array
+    *entry = LINVOKE_INDEX_TOMBSTONE;
+
+    if (atomic_load_explicit(&signal->queue.limit, memory_order_relaxed) > 0)
+    {
+        atomic_fetch_sub_explicit(&linvoke->limited_signal_count, 1, memory_order_relaxed);
+        linvoke_queue_set_limit(&signal->queue, 0, LINVOKE_OVERFLOW_DROP_NEWEST);
+    }
+
+    if (signal->priority > 0)
+    {
+        atomic_fetch_sub_explicit(&linvoke->prioritized_signal_count, 1, memory_order_relaxed);
+        signal->priority = 0;
+    }
+
+    signal->registered = false;
+    signal->parallel = false;
+    signal->recorded_payload_size = 0;
+    signal->connected_slot_count = 0;
+    signal->slot_array_length = 0;
+
+    --linvoke->registered_signal_count;
+}
+
+void linvoke_compact(linvoke_s *const linvoke)
+{
+#ifndef LINVOKE_MAX_SIGNALS
+    // Allocate the new signal index first, so a failed allocation leaves everything untouched
+    uint32_t signal_index_capacity = linvoke_round_up_to_power_of_two(2 * linvoke->registered_signal_count);
+
+    if (signal_index_capacity < LINVOKE_SIGNAL_INDEX_MINIMUM_CAPACITY)
+    {
+        signal_index_capacity = LINVOKE_SIGNAL_INDEX_MINIMUM_CAPACITY;
+    }
+
+    uint32_t *signal_index = calloc(signal_index_capacity, sizeof(*signal_index));
+
+    if (signal_index == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the signal index.\n");
+        return;
+    }
+#endif
+
+    // Move the registered signals to the front of the signals array, keeping their order
+    uint32_t signal_array_length = 0;
+
+    for (uint32_t i = 0; i < linvoke->signal_array_length; ++i)
+    {
+        if (!linvoke->signals[i].registered)
+        {
+#ifndef LINVOKE_MAX_SIGNALS
+            free(linvoke->signals[i].slot_set);
+            free(linvoke->signals[i].slots);
+            linvoke_keyed_free(&linvoke->signals[i].keyed_slots);
+#endif
+            continue;
+        }
+
+        linvoke_compact_slots(&linvoke->signals[i]);
+
+#ifndef LINVOKE_MAX_SIGNALS
+        linvoke_keyed_compact(&linvoke->signals[i].keyed_slots);
+#endif
+
+#ifdef LINVOKE_MAX_SIGNALS
+        // The row of the slot storage belongs to the position in the signals array, so the slots move with the signal
+        if (signal_array_length != i)
+        {
+            memcpy(linvoke->slot_storage[signal_array_length], linvoke->signals[i].slots, linvoke->signals[i].slot_array_length * sizeof(linvoke_slot_s));
+            linvoke->signals[i].slots = linvoke->slot_storage[signal_array_length];
+        }
+#endif
+
+        linvoke->signals[signal_array_length++] = linvoke->signals[i];
+    }
+
+    linvoke->signal_array_length = signal_array_length;
+
+#ifdef LINVOKE_MAX_SIGNALS
+    // The signal index has a fixed capacity, so it is cleared and refilled in place, which also drops its tombstones
+    memset(linvoke->signal_index, 0, linvoke->signal_index_capacity * sizeof(*linvoke->signal_index));
+#else
+
+    // Return the unused part of the signals array to the allocator
+    uint32_t signal_capacity = linvoke_round_up_to_block_size(signal_array_length, LINVOKE_SIGNAL_ARRAY_BLOCK_SIZE);
+
+    if (signal_capacity == 0)
+    {
+        signal_capacity = LINVOKE_SIGNAL_ARRAY_BLOCK_SIZE;
+    }
+
+    if (signal_capacity < linvoke->signal_capacity)
+    {
+        linvoke_signal_data_s *reallocated_signals = realloc(linvoke->signals, signal_capacity * sizeof(*linvoke->signals));
+
+        // Shrinking is allowed to fail, the old array is still valid in that case
+        if (reallocated_signals != NULL)
+        {
+            linvoke->signals = reallocated_signals;
+            linvoke->signal_capacity = signal_capacity;
+        }
+    }
+
+    // The positions of the signals changed, so the signal index is rebuilt, which also drops its tombstones
+    free(linvoke->signal_index);
+    linvoke->signal_index = signal_index;
+    linvoke->signal_index_capacity = signal_index_capacity;
+#endif
+
+    for (uint32_t i = 0; i < linvoke->signal_array_length; ++i)
+    {
+        linvoke_signal_index_insert(linvoke, i);
+    }
 }
 
 void linvoke_emit(linvoke_s *const linvoke, const linvoke_signal signal_id, void *user_data)
@@ -218,34 +1085,166 @@ void linvoke_emit(linvoke_s *const linvoke, const linvoke_signal signal_id, void
         return;
     }
 
-    linvoke_event_s event = { .signal_id = signal_id, .user_data = user_data };
+    linvoke_emit_signal(linvoke, signal, user_data, NULL);
+}
+
+void linvoke_emit_typed(linvoke_s *const linvoke, const linvoke_signal signal_id, void *user_data, const void *type)
+{
+    // Find the signal with the given ID
+    linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
+
+    // Signal not found
+    if (signal == NULL)
+    {
+        fprintf(stderr, "A signal with id %u does not exist.\n", signal_id);
+        return;
+    }
+
+    linvoke_emit_signal(linvoke, signal, user_data, type);
+}
+
+#ifndef LINVOKE_MAX_SIGNALS
+void linvoke_set_parallel(linvoke_s *const linvoke, const linvoke_signal signal_id, const bool parallel)
+{
+    // Find the signal with the given ID
+    linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
+
+    // Signal not found
+    if (signal == NULL)
+    {
+        fprintf(stderr, "A signal with id %u does not exist.\n", signal_id);
+        return;
+    }
 
-    // Call the callback function for all slots connected to the signal and override the user data
-    for (size_t j = 0; j < signal->connected_slot_count; ++j)
+    // The worker pool is started when the first signal is made parallel
+    if (parallel && linvoke->pool == NULL)
     {
-        signal->slots[j](&event);
+        long worker_count = LINVOKE_PARALLEL_WORKER_COUNT;
+
+        if (worker_count == 0)
+        {
+            worker_count = sysconf(_SC_NPROCESSORS_ONLN) - 1;
+        }
+
+        // On a single processor there is nobody to share the slots with, so the signal keeps emitting inline
+        if (worker_count > 0)
+        {
+            linvoke->pool = linvoke_pool_create((uint32_t) worker_count);
+        }
     }
+
+    signal->parallel = parallel;
 }
 
-linvoke_signal_data_s *linvoke_find_signal(linvoke_s *const linvoke, const linvoke_signal signal_id)
+void linvoke_set_profile_rate(linvoke_s *const linvoke, const uint32_t rate)
+{
+    atomic_store_explicit(&linvoke->profile_rate, rate, memory_order_relaxed);
+    atomic_store_explicit(&linvoke->profile_countdown, rate, memory_order_relaxed);
+}
+
+void linvoke_profile_report(linvoke_s *const linvoke, FILE *const stream, const uint32_t top_n)
+{
+    if (linvoke->profiler == NULL)
+    {
+        fprintf(stream, "No slot calls were sampled.\n");
+        return;
+    }
+
+    linvoke_profiler_report(linvoke->profiler, stream, top_n);
+}
+
+void linvoke_profile_reset(linvoke_s *const linvoke)
+{
+    if (linvoke->profiler != NULL)
+    {
+        linvoke_profiler_reset(linvoke->profiler);
+    }
+}
+
+linvoke_signal linvoke_register_named(linvoke_s *const linvoke, const char *const name)
 {
-    for (uint32_t i = 0; i < linvoke->registered_signal_count; ++i)
+    const uint64_t hash = linvoke_intern_hash(name);
+    linvoke_signal signal_id;
+
+    // A name that was interned before keeps its ID, and a name whose signal is registered is not registered again
+    if (linvoke_interner_find(&linvoke->interner, name, hash, &signal_id))
     {
-        if (linvoke->signals[i].id == signal_id)
+        if (linvoke_find_signal(linvoke, signal_id) != NULL)
         {
-            return &linvoke->signals[i];
+            return signal_id;
         }
     }
+    else
+    {
+        // Integer IDs can not be registered in the range of the named signals, so the IDs are handed out in order.
+        // The last ID of the range is LINVOKE_NO_SIGNAL, which is never handed out
+        if (linvoke->next_named_signal_id == LINVOKE_NO_SIGNAL)
+        {
+            fprintf(stderr, "There are no IDs left for the signal named %s.\n", name);
+            return LINVOKE_NO_SIGNAL;
+        }
 
-    return NULL;
+        signal_id = linvoke->next_named_signal_id;
+
+        if (!linvoke_interner_insert(&linvoke->interner, name, hash, signal_id))
+        {
+            return LINVOKE_NO_SIGNAL;
+        }
+
+        ++linvoke->next_named_signal_id;
+    }
+
+    // Named signals are registered past the check of linvoke_register_signal, which rejects their IDs
+    if (!linvoke_reserve_signals(linvoke, linvoke->signal_array_length + 1))
+    {
+        return LINVOKE_NO_SIGNAL;
+    }
+
+    linvoke_append_signal(linvoke, signal_id);
+
+    return signal_id;
 }
 
-uint32_t linvoke_get_registered_signal_count(linvoke_s *const linvoke)
+linvoke_signal linvoke_find_named(linvoke_s *const linvoke, const char *const name)
 {
-    return linvoke->registered_signal_count;
+    linvoke_signal signal_id;
+
+    if (!linvoke_interner_find(&linvoke->interner, name, linvoke_intern_hash(name), &signal_id))
+    {
+        return LINVOKE_NO_SIGNAL;
+    }
+
+    return signal_id;
 }
 
-uint32_t linvoke_get_slot_count(linvoke_s *const linvoke, const linvoke_signal signal_id)
+void linvoke_emit_named(linvoke_s *const linvoke, linvoke_named_signal_s *const signal, void *user_data)
+{
+    // Resolve the name only if it was never resolved in this linvoke object
+    if (signal->owner != linvoke->serial)
+    {
+        if (signal->hash == 0)
+        {
+            signal->hash = linvoke_intern_hash(signal->name);
+        }
+
+        if (!linvoke_interner_find(&linvoke->interner, signal->name, signal->hash, &signal->signal_id))
+        {
+            fprintf(stderr, "A signal named %s does not exist.\n", signal->name);
+            return;
+        }
+
+        signal->owner = linvoke->serial;
+    }
+
+    linvoke_emit(linvoke, signal->signal_id, user_data);
+}
+
+void linvoke_connect_keyed(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint64_t key, linvoke_slot_pointer slot)
+{
+    linvoke_connect_keyed_with_context(linvoke, signal_id, key, slot, NULL);
+}
+
+bool linvoke_connect_keyed_with_context(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint64_t key, linvoke_slot_pointer slot, void *context)
 {
     // Find the signal with the given ID
     linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
@@ -253,19 +1252,1186 @@ uint32_t linvoke_get_slot_count(linvoke_s *const linvoke, const linvoke_signal s
     // Signal not found
     if (signal == NULL)
     {
-        fprintf(stderr, "Signal with id %u not found.\n", signal_id);
-        return 0;
+        fprintf(stderr, "A signal with id %u does not exist.\n", signal_id);
+        return false;
     }
 
-    return signal->connected_slot_count;
+    const linvoke_keyed_slot_s connected_slot = { .function = slot, .context = context };
+    const linvoke_keyed_entry_s *const entry = linvoke_keyed_find(&signal->keyed_slots, key);
+
+    // Check if the callback is already connected for the key
+    if (entry != NULL && linvoke_keyed_find_slot(entry, connected_slot) != UINT32_MAX)
+    {
+        fprintf(stderr, "The callback function is already connected to signal %u for key %lu\n", signal_id, (unsigned long) key);
+        return false;
+    }
+
+    return linvoke_keyed_connect(&signal->keyed_slots, key, connected_slot);
 }
 
-linvoke_signal linvoke_event_get_signal_id(linvoke_event_s *const event)
+void linvoke_disconnect_keyed(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint64_t key, linvoke_slot_pointer slot)
 {
-    return event->signal_id;
+    linvoke_disconnect_keyed_with_context(linvoke, signal_id, key, slot, NULL);
 }
 
-void *linvoke_event_get_user_data(linvoke_event_s *const event)
+void linvoke_disconnect_keyed_with_context(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint64_t key, linvoke_slot_pointer slot, void *context)
 {
-    return event->user_data;
+    // Find the signal with the given ID
+    linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
+
+    // Signal not found
+    if (signal == NULL)
+    {
+        fprintf(stderr, "A signal with id %u does not exist.\n", signal_id);
+        return;
+    }
+
+    const linvoke_keyed_slot_s disconnected_slot = { .function = slot, .context = context };
+    linvoke_keyed_entry_s *const entry = linvoke_keyed_find(&signal->keyed_slots, key);
+    const uint32_t slot_position = entry != NULL ? linvoke_keyed_find_slot(entry, disconnected_slot) : UINT32_MAX;
+
+    // Slot not connected
+    if (slot_position == UINT32_MAX)
+    {
+        fprintf(stderr, "The callback function is not connected to signal %u for key %lu\n", signal_id, (unsigned long) key);
+        return;
+    }
+
+    // Leave a tombstone, so a keyed emission that is calling the slots of the key does not skip any
+    entry->slots[slot_position].function = NULL;
+
+    --entry->connected_slot_count;
+}
+
+void linvoke_emit_keyed(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint64_t key, void *user_data)
+{
+    // Find the signal with the given ID
+    linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
+
+    // Signal not found
+    if (signal == NULL)
+    {
+        fprintf(stderr, "A signal with id %u does not exist.\n", signal_id);
+        return;
+    }
+
+    linvoke_emit_signal(linvoke, signal, user_data, NULL);
+
+    const linvoke_keyed_table_s *const keyed_slots = &signal->keyed_slots;
+    const linvoke_keyed_entry_s *entry = linvoke_keyed_find(keyed_slots, key);
+
+    // An unkeyed slot may have unregistered the signal
+    if (entry == NULL || !signal->registered)
+    {
+        return;
+    }
+
+    // Slots connected for the key while it is emitted are not called by this emission
+    const uint32_t slot_array_length = entry->slot_array_length;
+    linvoke_event_s event = { .signal_id = signal_id, .user_data = user_data, .type = NULL, .context = NULL };
+
+    for (uint32_t i = 0; i < slot_array_length && signal->registered; ++i)
+    {
+        const linvoke_keyed_slot_s slot = entry->slots[i];
+
+        if (slot.function == NULL)
+        {
+            continue;
+        }
+
+        const linvoke_keyed_entry_s *const entries = keyed_slots->entries;
+
+        event.context = slot.context;
+        slot.function(&event);
+
+        // A slot that connects a slot for a new key can move the entries, so the entry is looked up again
+        if (keyed_slots->entries != entries)
+        {
+            entry = linvoke_keyed_find(keyed_slots, key);
+        }
+    }
+}
+
+uint32_t linvoke_get_keyed_slot_count(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint64_t key)
+{
+    // Find the signal with the given ID
+    linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
+
+    // Signal not found
+    if (signal == NULL)
+    {
+        fprintf(stderr, "A signal with id %u does not exist.\n", signal_id);
+        return 0;
+    }
+
+    const linvoke_keyed_entry_s *const entry = linvoke_keyed_find(&signal->keyed_slots, key);
+
+    return entry != NULL ? entry->connected_slot_count : 0;
+}
+
+linvoke_timer linvoke_emit_after(linvoke_s *const linvoke, const linvoke_signal signal_id, void *user_data, const uint64_t delay)
+{
+    return linvoke_timer_wheel_add(&linvoke->timers, signal_id, user_data, delay, 0);
+}
+
+linvoke_timer linvoke_emit_every(linvoke_s *const linvoke, const linvoke_signal signal_id, void *user_data, const uint64_t period)
+{
+    if (period == 0)
+    {
+        fprintf(stderr, "The period of a timer must not be 0.\n");
+        return LINVOKE_NO_TIMER;
+    }
+
+    return linvoke_timer_wheel_add(&linvoke->timers, signal_id, user_data, period, period);
+}
+
+bool linvoke_cancel_timer(linvoke_s *const linvoke, const linvoke_timer timer)
+{
+    return linvoke_timer_wheel_cancel(&linvoke->timers, timer);
+}
+
+uint32_t linvoke_advance_time(linvoke_s *const linvoke, const uint64_t now)
+{
+    return linvoke_timer_wheel_advance(&linvoke->timers, now, linvoke_emit_timer, linvoke);
+}
+
+uint64_t linvoke_get_time(linvoke_s *const linvoke)
+{
+    return linvoke->timers.current_time;
+}
+#endif
+
+bool linvoke_record_start(linvoke_s *const linvoke, const char *const path)
+{
+    // Starting a new recording finishes the previous one
+    linvoke_recorder_close(&linvoke->recorder);
+
+    return linvoke_recorder_open(&linvoke->recorder, path);
+}
+
+void linvoke_record_stop(linvoke_s *const linvoke)
+{
+    linvoke_recorder_close(&linvoke->recorder);
+}
+
+void linvoke_record_payload(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint32_t payload_size)
+{
+    // Find the signal with the given ID
+    linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
+
+    // Signal not found
+    if (signal == NULL)
+    {
+        fprintf(stderr, "A signal with id %u does not exist.\n", signal_id);
+        return;
+    }
+
+    signal->recorded_payload_size = payload_size;
+}
+
+void linvoke_set_priority(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint32_t priority)
+{
+    // Find the signal with the given ID
+    linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
+
+    // Signal not found
+    if (signal == NULL)
+    {
+        fprintf(stderr, "A signal with id %u does not exist.\n", signal_id);
+        return;
+    }
+
+    if (priority >= LINVOKE_PRIORITY_COUNT)
+    {
+        fprintf(stderr, "The priority of a signal must be below %u.\n", LINVOKE_PRIORITY_COUNT);
+        return;
+    }
+
+    if (signal->priority == 0 && priority > 0)
+    {
+        atomic_fetch_add_explicit(&linvoke->prioritized_signal_count, 1, memory_order_relaxed);
+    }
+    else if (signal->priority > 0 && priority == 0)
+    {
+        atomic_fetch_sub_explicit(&linvoke->prioritized_signal_count, 1, memory_order_relaxed);
+    }
+
+    signal->priority = priority;
+}
+
+void linvoke_set_queue_limit(linvoke_s *const linvoke, const uint32_t max_events, const linvoke_overflow_policy policy)
+{
+    // The post queue holds events of many signals, so there is no single signal whose events could be coalesced
+    if (policy == LINVOKE_OVERFLOW_COALESCE)
+    {
+        fprintf(stderr, "The post queue of a linvoke object can not coalesce events.\n");
+        return;
+    }
+
+    linvoke_queue_set_limit(&linvoke->queue, max_events, policy);
+}
+
+void linvoke_set_signal_queue_limit(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint32_t max_events, const linvoke_overflow_policy policy)
+{
+    // Find the signal with the given ID
+    linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
+
+    // Signal not found
+    if (signal == NULL)
+    {
+        fprintf(stderr, "A signal with id %u does not exist.\n", signal_id);
+        return;
+    }
+
+    const bool was_limited = atomic_load_explicit(&signal->queue.limit, memory_order_relaxed) > 0;
+
+    linvoke_queue_set_limit(&signal->queue, max_events, policy);
+
+    if (!was_limited && max_events > 0)
+    {
+        atomic_fetch_add_explicit(&linvoke->limited_signal_count, 1, memory_order_relaxed);
+    }
+    else if (was_limited && max_events == 0)
+    {
+        atomic_fetch_sub_explicit(&linvoke->limited_signal_count, 1, memory_order_relaxed);
+    }
+}
+
+void linvoke_get_queue_stats(linvoke_s *const linvoke, linvoke_queue_stats_s *const stats)
+{
+    linvoke_queue_get_stats(&linvoke->queue, stats);
+}
+
+void linvoke_get_signal_queue_stats(linvoke_s *const linvoke, const linvoke_signal signal_id, linvoke_queue_stats_s *const stats)
+{
+    // Find the signal with the given ID
+    linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
+
+    // Signal not found
+    if (signal == NULL)
+    {
+        fprintf(stderr, "A signal with id %u does not exist.\n", signal_id);
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+
+    linvoke_queue_get_stats(&signal->queue, stats);
+}
+
+linvoke_post_status linvoke_post(linvoke_s *const linvoke, const linvoke_signal signal_id, const void *const payload, const uint32_t size)
+{
+    linvoke_post_status status;
+    void *const reserved_payload = linvoke_post_reserve_with_status(linvoke, signal_id, size, &status);
+
+    if (reserved_payload == NULL)
+    {
+        return status;
+    }
+
+    if (size > 0)
+    {
+        memcpy(reserved_payload, payload, size);
+    }
+
+    linvoke_post_commit(linvoke, reserved_payload);
+
+    return status;
+}
+
+void *linvoke_post_reserve(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint32_t size)
+{
+    linvoke_post_status status;
+    return linvoke_post_reserve_with_status(linvoke, signal_id, size, &status);
+}
+
+void linvoke_post_commit(linvoke_s *const linvoke, void *const payload)
+{
+    linvoke_ring_commit((linvoke_post_header_s *) payload - 1);
+
+    // Pairs with the fence in linvoke_dispatch and linvoke_get_fd: either the consumer sees the published record,
+    // or this producer sees that the eventfd was created or that the pending flag was cleared, and signals the eventfd
+    atomic_thread_fence(memory_order_seq_cst);
+
+    // Acquire pairs with the release in linvoke_get_fd, so the producer sees the eventfd fully created
+    const int wakeup_fd = atomic_load_explicit(&linvoke->wakeup_fd, memory_order_acquire);
+
+    if (wakeup_fd < 0)
+    {
+        return;
+    }
+
+    // Only the producer that makes the queue go from empty to non-empty pays for the system call.
+    // The flag is read before it is exchanged, so producers do not contend on it while it is already set
+    if (!atomic_load_explicit(&linvoke->wakeup_pending, memory_order_relaxed) && !atomic_exchange_explicit(&linvoke->wakeup_pending, true, memory_order_relaxed))
+    {
+        eventfd_write(wakeup_fd, 1);
+    }
+}
+
+int linvoke_get_fd(linvoke_s *const linvoke)
+{
+    int wakeup_fd = atomic_load_explicit(&linvoke->wakeup_fd, memory_order_relaxed);
+
+    if (wakeup_fd >= 0)
+    {
+        return wakeup_fd;
+    }
+
+    wakeup_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+    if (wakeup_fd < 0)
+    {
+        fprintf(stderr, "Failed to create the linvoke eventfd.\n");
+        return -1;
+    }
+
+    atomic_store_explicit(&linvoke->wakeup_fd, wakeup_fd, memory_order_release);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    // Events that were posted before the eventfd existed did not signal it
+    if (linvoke_has_pending_events(linvoke) && !atomic_exchange_explicit(&linvoke->wakeup_pending, true, memory_order_relaxed))
+    {
+        eventfd_write(wakeup_fd, 1);
+    }
+
+    return wakeup_fd;
+}
+
+uint32_t linvoke_dispatch(linvoke_s *const linvoke)
+{
+    return linvoke_dispatch_with_budget(linvoke, 0, 0);
+}
+
+uint32_t linvoke_dispatch_with_budget(linvoke_s *const linvoke, const uint32_t max_events, const uint64_t max_nanoseconds)
+{
+    const int wakeup_fd = atomic_load_explicit(&linvoke->wakeup_fd, memory_order_relaxed);
+
+    // Consume the wakeup before draining, so any event that is committed after this point signals the eventfd again
+    if (wakeup_fd >= 0 && atomic_exchange_explicit(&linvoke->wakeup_pending, false, memory_order_relaxed))
+    {
+        eventfd_t value;
+        eventfd_read(wakeup_fd, &value);
+    }
+
+    // Pairs with the fence in linvoke_post_commit
+    atomic_thread_fence(memory_order_seq_cst);
+
+    const uint32_t max_event_count = max_events > 0 ? max_events : UINT32_MAX;
+    const uint64_t deadline = max_nanoseconds > 0 ? linvoke_get_monotonic_time() + max_nanoseconds : 0;
+    uint32_t dispatched_event_count = 0;
+
+    // Higher lanes are drained first, but the lanes that were starved by the previous dispatches go before all others
+    for (uint32_t pass = 0; pass < 2; ++pass)
+    {
+        for (uint32_t priority = LINVOKE_PRIORITY_COUNT; priority-- > 0;)
+        {
+            const bool starved = linvoke->starved_dispatch_counts[priority] >= LINVOKE_PRIORITY_STARVATION_LIMIT;
+
+            if (starved == (pass == 0))
+            {
+                dispatched_event_count += linvoke_ring_drain(linvoke->post_queues[priority], linvoke_dispatch_record, linvoke, max_event_count - dispatched_event_count, deadline);
+            }
+        }
+    }
+
+    bool has_pending_events = false;
+
+    for (uint32_t priority = 0; priority < LINVOKE_PRIORITY_COUNT; ++priority)
+    {
+        if (linvoke_ring_has_committed_record(linvoke->post_queues[priority]))
+        {
+            ++linvoke->starved_dispatch_counts[priority];
+            has_pending_events = true;
+        }
+        else
+        {
+            linvoke->starved_dispatch_counts[priority] = 0;
+        }
+    }
+
+    // The producers of the events that were left will not signal the eventfd again, so it is signaled here
+    if (has_pending_events && wakeup_fd >= 0 && !atomic_exchange_explicit(&linvoke->wakeup_pending, true, memory_order_relaxed))
+    {
+        eventfd_write(wakeup_fd, 1);
+    }
+
+    // Pairs with the fence in linvoke_wait_for_room: either the producer sees the room that was made,
+    // or this thread sees that the producer is waiting and changes the release sequence before waking it up
+    atomic_thread_fence(memory_order_seq_cst);
+
+    if (atomic_load_explicit(&linvoke->blocked_producer_count, memory_order_relaxed) > 0)
+    {
+        atomic_fetch_add_explicit(&linvoke->release_sequence, 1, memory_order_relaxed);
+        linvoke_queue_wake(&linvoke->release_sequence);
+    }
+
+    return dispatched_event_count;
+}
+
+linvoke_signal_data_s *linvoke_find_signal(linvoke_s *const linvoke, const linvoke_signal signal_id)
+{
+    uint32_t *const entry = linvoke_find_signal_index_entry(linvoke, signal_id);
+
+    if (entry == NULL)
+    {
+        return NULL;
+    }
+
+    return &linvoke->signals[*entry - 1];
+}
+
+static uint32_t *linvoke_find_signal_index_entry(linvoke_s *const linvoke, const linvoke_signal signal_id)
+{
+    const uint32_t mask = linvoke->signal_index_capacity - 1;
+
+    // Probe the signal index until the signal or an empty entry is found
+    for (uint32_t i = linvoke_hash_signal_id(signal_id) & mask; linvoke->signal_index[i] != LINVOKE_INDEX_EMPTY; i = (i + 1) & mask)
+    {
+        if (linvoke->signal_index[i] != LINVOKE_INDEX_TOMBSTONE && linvoke->signals[linvoke->signal_index[i] - 1].id == signal_id)
+        {
+            return &linvoke->signal_index[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void linvoke_signal_index_insert(linvoke_s *const linvoke, const uint32_t signal_position)
+{
+    const uint32_t mask = linvoke->signal_index_capacity - 1;
+    uint32_t i = linvoke_hash_signal_id(linvoke->signals[signal_position].id) & mask;
+
+    // The signal is known not to be in the index, so the first tombstone can be reused
+    while (linvoke->signal_index[i] != LINVOKE_INDEX_EMPTY && linvoke->signal_index[i] != LINVOKE_INDEX_TOMBSTONE)
+    {
+        i = (i + 1) & mask;
+    }
+
+    linvoke->signal_index[i] = signal_position + 1;
+}
+
+#ifndef LINVOKE_MAX_SIGNALS
+static bool linvoke_rebuild_signal_index(linvoke_s *const linvoke, const uint32_t capacity)
+{
+    uint32_t *signal_index = calloc(capacity, sizeof(*signal_index));
+
+    if (signal_index == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the signal index.\n");
+        return false;
+    }
+
+    free(linvoke->signal_index);
+    linvoke->signal_index = signal_index;
+    linvoke->signal_index_capacity = capacity;
+
+    for (uint32_t i = 0; i < linvoke->signal_array_length; ++i)
+    {
+        if (linvoke->signals[i].registered)
+        {
+            linvoke_signal_index_insert(linvoke, i);
+        }
+    }
+
+    return true;
+}
+#endif
+
+static bool linvoke_reserve_signals(linvoke_s *const linvoke, const uint32_t signal_count)
+{
+#ifdef LINVOKE_MAX_SIGNALS
+    // The signals array and the signal index have a fixed capacity, which was chosen for LINVOKE_MAX_SIGNALS
+    if (signal_count > linvoke->signal_capacity)
+    {
+        fprintf(stderr, "A linvoke object can not hold more than %u signals.\n", LINVOKE_MAX_SIGNALS);
+        return false;
+    }
+#else
+    // Reallocate the signals array memory in multiples of the block size
+    if (signal_count > linvoke->signal_capacity)
+    {
+        const uint32_t signal_capacity = linvoke_round_up_to_block_size(signal_count, LINVOKE_SIGNAL_ARRAY_BLOCK_SIZE);
+        linvoke_signal_data_s *reallocated_signals = realloc(linvoke->signals, signal_capacity * sizeof(*linvoke->signals));
+
+        if (reallocated_signals == NULL)
+        {
+            fprintf(stderr, "Failed to reallocate memory for the signals array.\n");
+            return false;
+        }
+
+        linvoke->signals = reallocated_signals;
+        linvoke->signal_capacity = signal_capacity;
+    }
+
+    // Keep the load factor of the signal index, tombstones included, at or below one half, so probe sequences stay short
+    if (2 * signal_count > linvoke->signal_index_capacity)
+    {
+        return linvoke_rebuild_signal_index(linvoke, linvoke_round_up_to_power_of_two(2 * signal_count));
+    }
+#endif
+
+    return true;
+}
+
+static void linvoke_append_signal(linvoke_s *const linvoke, const linvoke_signal signal_id)
+{
+    linvoke_signal_data_s *const signal = &linvoke->signals[linvoke->signal_array_length];
+    signal->id = signal_id;
+    signal->registered = true;
+    signal->parallel = false;
+    signal->recorded_payload_size = 0;
+    signal->priority = 0;
+    signal->connected_slot_count = 0;
+    signal->slot_array_length = 0;
+    signal->slot_set = NULL;
+    linvoke_queue_init(&signal->queue);
+    signal->slot_set_capacity = 0;
+
+#ifdef LINVOKE_MAX_SIGNALS
+    // Every position in the signals array owns a row of the slot storage
+    signal->slots = linvoke->slot_storage[linvoke->signal_array_length];
+    signal->slot_capacity = LINVOKE_MAX_SLOTS_PER_SIGNAL;
+#else
+    // The slots array is allocated when the first slot is connected
+    signal->slots = NULL;
+    signal->slot_capacity = 0;
+    linvoke_keyed_init(&signal->keyed_slots);
+#endif
+
+    linvoke_signal_index_insert(linvoke, linvoke->signal_array_length);
+
+    ++linvoke->signal_array_length;
+    ++linvoke->registered_signal_count;
+}
+
+static bool linvoke_reserve_slots(linvoke_signal_data_s *const signal, const uint32_t slot_count)
+{
+#ifdef LINVOKE_MAX_SIGNALS
+    // The slots array has a fixed capacity and is small enough to be scanned, so the signal never gets a slot set
+    if (slot_count > signal->slot_capacity)
+    {
+        fprintf(stderr, "A signal can not have more than %u slots.\n", LINVOKE_MAX_SLOTS_PER_SIGNAL);
+        return false;
+    }
+#else
+    // Reallocate the slots array memory in multiples of the block size
+    if (slot_count > signal->slot_capacity)
+    {
+        const uint32_t slot_capacity = linvoke_round_up_to_block_size(slot_count, LINVOKE_SLOT_ARRAY_BLOCK_SIZE);
+        linvoke_slot_s *reallocated_slots = realloc(signal->slots, slot_capacity * sizeof(*signal->slots));
+
+        if (reallocated_slots == NULL)
+        {
+            fprintf(stderr, "Failed to reallocate memory for the slots array.\n");
+            return false;
+        }
+
+        signal->slots = reallocated_slots;
+        signal->slot_capacity = slot_capacity;
+    }
+
+    // Keep the load factor of the slot set, tombstones included, at or below one half, so probe sequences stay short
+    if (slot_count >= LINVOKE_SLOT_SET_THRESHOLD && 2 * slot_count > signal->slot_set_capacity)
+    {
+        return linvoke_rebuild_slot_set(signal, linvoke_round_up_to_power_of_two(2 * slot_count));
+    }
+#endif
+
+    return true;
+}
+
+static void linvoke_reuse_disconnected_slots(linvoke_signal_data_s *const signal, const uint32_t slot_count)
+{
+    // Moving the slots while an emission walks the array would make it skip or repeat slots
+    if (linvoke_emission_depth > 0 || signal->slot_array_length + slot_count <= signal->slot_capacity)
+    {
+        return;
+    }
+
+    // Compacting keeps the order of the slots, so the slots array only grows once at least half of it is connected
+    if (2 * signal->connected_slot_count <= signal->slot_array_length)
+    {
+        linvoke_compact_slots(signal);
+    }
+}
+
+static void linvoke_append_slot(linvoke_signal_data_s *const signal, const linvoke_slot_s slot)
+{
+    signal->slots[signal->slot_array_length] = slot;
+
+    if (signal->slot_set != NULL)
+    {
+        linvoke_slot_set_insert(signal, signal->slot_array_length);
+    }
+
+    ++signal->slot_array_length;
+    ++signal->connected_slot_count;
+}
+
+static uint32_t linvoke_find_slot(const linvoke_signal_data_s *const signal, const linvoke_slot_s slot)
+{
+    if (signal->slot_set != NULL)
+    {
+        const uint32_t *const entry = linvoke_find_slot_set_entry(signal, slot);
+        return entry != NULL ? *entry - 1 : UINT32_MAX;
+    }
+
+    for (uint32_t i = 0; i < signal->slot_array_length; ++i)
+    {
+        if (linvoke_is_same_slot(signal->slots[i], slot))
+        {
+            return i;
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+static uint32_t *linvoke_find_slot_set_entry(const linvoke_signal_data_s *const signal, const linvoke_slot_s slot)
+{
+    const uint32_t mask = signal->slot_set_capacity - 1;
+
+    // Probe the slot set until the slot or an empty entry is found
+    for (uint32_t i = linvoke_hash_slot(slot) & mask; signal->slot_set[i] != LINVOKE_INDEX_EMPTY; i = (i + 1) & mask)
+    {
+        if (signal->slot_set[i] != LINVOKE_INDEX_TOMBSTONE && linvoke_is_same_slot(signal->slots[signal->slot_set[i] - 1], slot))
+        {
+            return &signal->slot_set[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void linvoke_slot_set_insert(linvoke_signal_data_s *const signal, const uint32_t slot_position)
+{
+    const uint32_t mask = signal->slot_set_capacity - 1;
+    uint32_t i = linvoke_hash_slot(signal->slots[slot_position]) & mask;
+
+    // The slot is known not to be in the set, so the first tombstone can be reused
+    while (signal->slot_set[i] != LINVOKE_INDEX_EMPTY && signal->slot_set[i] != LINVOKE_INDEX_TOMBSTONE)
+    {
+        i = (i + 1) & mask;
+    }
+
+    signal->slot_set[i] = slot_position + 1;
+}
+
+#ifndef LINVOKE_MAX_SIGNALS
+static bool linvoke_rebuild_slot_set(linvoke_signal_data_s *const signal, const uint32_t capacity)
+{
+    uint32_t *slot_set = NULL;
+
+    if (capacity != 0)
+    {
+        slot_set = calloc(capacity, sizeof(*slot_set));
+
+        if (slot_set == NULL)
+        {
+            fprintf(stderr, "Failed to allocate memory for the slot set.\n");
+            return false;
+        }
+    }
+
+    free(signal->slot_set);
+    signal->slot_set = slot_set;
+    signal->slot_set_capacity = capacity;
+
+    for (uint32_t i = 0; slot_set != NULL && i < signal->slot_array_length; ++i)
+    {
+        if (signal->slots[i].function != NULL)
+        {
+            linvoke_slot_set_insert(signal, i);
+        }
+    }
+
+    return true;
+}
+#endif
+
+static void linvoke_compact_slots(linvoke_signal_data_s *const signal)
+{
+    // Move the connected slots to the front of the slots array, keeping their order
+    uint32_t slot_array_length = 0;
+
+    for (uint32_t i = 0; i < signal->slot_array_length; ++i)
+    {
+        if (signal->slots[i].function != NULL)
+        {
+            signal->slots[slot_array_length++] = signal->slots[i];
+        }
+    }
+
+    signal->slot_array_length = slot_array_length;
+
+#ifndef LINVOKE_MAX_SIGNALS
+    // Return the unused part of the slots array to the allocator
+    const uint32_t slot_capacity = linvoke_round_up_to_block_size(slot_array_length, LINVOKE_SLOT_ARRAY_BLOCK_SIZE);
+
+    if (slot_capacity == 0)
+    {
+        free(signal->slots);
+        signal->slots = NULL;
+        signal->slot_capacity = 0;
+    }
+    else if (slot_capacity < signal->slot_capacity)
+    {
+        linvoke_slot_s *reallocated_slots = realloc(signal->slots, slot_capacity * sizeof(*signal->slots));
+
+        // Shrinking is allowed to fail, the old array is still valid in that case
+        if (reallocated_slots != NULL)
+        {
+            signal->slots = reallocated_slots;
+            signal->slot_capacity = slot_capacity;
+        }
+    }
+
+    // The positions of the slots changed, so the slot set is rebuilt, or removed if the signal has only a few slots left.
+    // The slot set is only an accelerator, so if it can not be allocated, it is removed as well
+    const uint32_t slot_set_capacity = slot_array_length >= LINVOKE_SLOT_SET_THRESHOLD ? linvoke_round_up_to_power_of_two(2 * slot_array_length) : 0;
+
+    if (!linvoke_rebuild_slot_set(signal, slot_set_capacity))
+    {
+        linvoke_rebuild_slot_set(signal, 0);
+    }
+#endif
+}
+
+static void linvoke_emit_signal(linvoke_s *const linvoke, linvoke_signal_data_s *const signal, void *const user_data, const void *const type)
+{
+    // Events without user data are recorded without a payload
+    if (linvoke->recorder.fd >= 0)
+    {
+        linvoke_recorder_append(&linvoke->recorder, signal->id, user_data, user_data != NULL ? signal->recorded_payload_size : 0);
+    }
+
+#ifndef LINVOKE_MAX_SIGNALS
+    const uint32_t profile_rate = atomic_load_explicit(&linvoke->profile_rate, memory_order_relaxed);
+
+    // Only a countdown is paid for the events that are not sampled. Events that the slots of parallel signals emit
+    // on the worker threads are never sampled, so the countdown and the profiler stay with the emitting thread
+    if (profile_rate > 0 && !linvoke_pool_is_worker_thread())
+    {
+        const uint32_t profile_countdown = atomic_load_explicit(&linvoke->profile_countdown, memory_order_relaxed);
+
+        if (profile_countdown <= 1)
+        {
+            atomic_store_explicit(&linvoke->profile_countdown, profile_rate, memory_order_relaxed);
+            linvoke_call_profiled_slots(linvoke, signal, user_data, type, profile_rate);
+            return;
+        }
+
+        atomic_store_explicit(&linvoke->profile_countdown, profile_countdown - 1, memory_order_relaxed);
+    }
+
+    // Large fan-outs of parallel signals are split across the worker pool. If the pool is busy,
+    // because a slot of a parallel signal emits another one, the event is emitted inline
+    if (signal->parallel && signal->connected_slot_count >= LINVOKE_PARALLEL_THRESHOLD && linvoke->pool != NULL)
+    {
+        linvoke_parallel_emission_s emission = { .signal = signal, .user_data = user_data, .type = type };
+
+        if (linvoke_pool_run(linvoke->pool, linvoke_call_parallel_slots, &emission, signal->slot_array_length))
+        {
+            return;
+        }
+    }
+#endif
+
+    linvoke_call_slots(signal, user_data, type, 0, signal->slot_array_length);
+}
+
+static void linvoke_call_slots(const linvoke_signal_data_s *const signal, void *const user_data, const void *const type, const uint32_t begin, const uint32_t end)
+{
+    linvoke_event_s event = { .signal_id = signal->id, .user_data = user_data, .type = type, .context = NULL };
+
+    // Slots connected from within the slots must not compact the slots array while it is walked here
+    ++linvoke_emission_depth;
+
+    // Call the callback function for all slots connected to the signal and override the user data.
+    // Disconnected slots are NULL until the linvoke object is compacted, so they are skipped.
+    // A slot that unregisters the signal disconnects the remaining ones as well
+    for (uint32_t j = begin; j < end && signal->registered; ++j)
+    {
+        const linvoke_slot_s slot = signal->slots[j];
+
+        if (slot.function != NULL)
+        {
+            event.context = slot.context;
+            slot.function(&event);
+        }
+    }
+
+    --linvoke_emission_depth;
+}
+
+#ifndef LINVOKE_MAX_SIGNALS
+static void linvoke_call_parallel_slots(void *context, const uint32_t begin, const uint32_t end)
+{
+    const linvoke_parallel_emission_s *const emission = context;
+    linvoke_call_slots(emission->signal, emission->user_data, emission->type, begin, end);
+}
+
+static void linvoke_call_profiled_slots(linvoke_s *const linvoke, const linvoke_signal_data_s *const signal, void *const user_data, const void *const type, const uint32_t rate)
+{
+    // The profiler is created by the emitting thread, so the rate can be set from any thread
+    if (linvoke->profiler == NULL)
+    {
+        linvoke->profiler = linvoke_profiler_create();
+
+        if (linvoke->profiler == NULL)
+        {
+            linvoke_call_slots(signal, user_data, type, 0, signal->slot_array_length);
+            return;
+        }
+    }
+
+    linvoke_event_s event = { .signal_id = signal->id, .user_data = user_data, .type = type, .context = NULL };
+
+    ++linvoke_emission_depth;
+
+    for (uint32_t j = 0; j < signal->slot_array_length && signal->registered; ++j)
+    {
+        const linvoke_slot_s slot = signal->slots[j];
+
+        if (slot.function == NULL)
+        {
+            continue;
+        }
+
+        event.context = slot.context;
+
+        const uint64_t start_time = linvoke_get_monotonic_time();
+        slot.function(&event);
+        const uint64_t end_time = linvoke_get_monotonic_time();
+
+        linvoke_profiler_add_sample(linvoke->profiler, slot.function, end_time - start_time, rate);
+    }
+
+    --linvoke_emission_depth;
+}
+
+static void linvoke_emit_timer(void *context, const linvoke_signal signal_id, void *user_data)
+{
+    linvoke_emit(context, signal_id, user_data);
+}
+#endif
+
+static void linvoke_init_post_queues(linvoke_s *const linvoke, uint8_t *const memory)
+{
+    uint8_t *ring_memory = memory;
+
+    for (uint32_t priority = 0; priority < LINVOKE_PRIORITY_COUNT; ++priority)
+    {
+        const uint64_t capacity = priority == 0 ? LINVOKE_POST_QUEUE_SIZE : LINVOKE_PRIORITY_LANE_SIZE;
+
+        linvoke->post_queues[priority] = (linvoke_ring_s *) ring_memory;
+        linvoke->starved_dispatch_counts[priority] = 0;
+        linvoke_ring_init(linvoke->post_queues[priority], capacity);
+
+        ring_memory += linvoke_ring_get_memory_size(capacity);
+    }
+}
+
+static bool linvoke_has_pending_events(linvoke_s *const linvoke)
+{
+    for (uint32_t priority = 0; priority < LINVOKE_PRIORITY_COUNT; ++priority)
+    {
+        const linvoke_ring_s *const post_queue = linvoke->post_queues[priority];
+
+        if (atomic_load_explicit(&post_queue->write_position, memory_order_relaxed) != post_queue->read_position)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void *linvoke_post_reserve_with_status(linvoke_s *const linvoke, const linvoke_signal signal_id, const uint32_t size, linvoke_post_status *const status)
+{
+    // The signal is only looked up if there is a signal with a limit or a priority,
+    // so posting without either never touches the signals
+    linvoke_queue_s *signal_queue = NULL;
+    uint32_t priority = 0;
+
+    if (atomic_load_explicit(&linvoke->limited_signal_count, memory_order_relaxed) > 0 || atomic_load_explicit(&linvoke->prioritized_signal_count, memory_order_relaxed) > 0)
+    {
+        linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
+
+        if (signal != NULL)
+        {
+            signal_queue = atomic_load_explicit(&signal->queue.limit, memory_order_relaxed) > 0 ? &signal->queue : NULL;
+            priority = signal->priority;
+        }
+    }
+
+    linvoke_ring_s *const post_queue = linvoke->post_queues[priority];
+    const uint64_t record_size = (uint64_t) size + sizeof(linvoke_post_header_s);
+
+    if (record_size > UINT32_MAX || !linvoke_ring_fits(post_queue, (uint32_t) record_size))
+    {
+        fprintf(stderr, "An event of %u bytes does not fit in the post queue.\n", size);
+        *status = LINVOKE_POST_FAILED;
+        return NULL;
+    }
+
+    linvoke_post_block_s block = { 0 };
+    linvoke_queue_s *blocking_queue = NULL;
+    linvoke_post_header_s *record = NULL;
+
+    // One producer at a time checks the limits, reserves its record and admits its event, so the records are in the same
+    // order in the post queue as their sequence numbers, and older events are only dropped once the new one has a record.
+    // No producer waits while it holds the lock
+    while (true)
+    {
+        linvoke_lock_posting(linvoke);
+
+        linvoke_queue_s *full_queue = NULL;
+
+        if (signal_queue != NULL && (!linvoke_queue_has_room(signal_queue, status) || *status == LINVOKE_POST_DROPPED))
+        {
+            full_queue = signal_queue;
+        }
+        else if (!linvoke_queue_has_room(&linvoke->queue, status) || *status == LINVOKE_POST_DROPPED)
+        {
+            full_queue = &linvoke->queue;
+        }
+        else
+        {
+            record = linvoke_ring_reserve(post_queue, signal_id, (uint32_t) record_size);
+        }
+
+        if (record != NULL)
+        {
+            linvoke_post_header_s header = { .sequence = 0, .signal_sequence = LINVOKE_POST_NO_SIGNAL_SEQUENCE };
+            const linvoke_post_status signal_status = signal_queue != NULL ? linvoke_queue_admit(signal_queue, &header.signal_sequence) : LINVOKE_POST_QUEUED;
+            *status = linvoke_queue_admit(&linvoke->queue, &header.sequence);
+            *record = header;
+
+            linvoke_unlock_posting(linvoke);
+
+            if (signal_status == LINVOKE_POST_REPLACED)
+            {
+                *status = LINVOKE_POST_REPLACED;
+            }
+
+            break;
+        }
+
+        linvoke_unlock_posting(linvoke);
+
+        if (*status == LINVOKE_POST_DROPPED)
+        {
+            linvoke_stop_waiting_for_room(linvoke, &block, blocking_queue);
+            return NULL;
+        }
+
+        // Independent of the limits, the post queue can run out of space. Older events can only give it back when they are
+        // dispatched, so the only choices are to wait for a dispatch or to drop the new event
+        if (full_queue == NULL)
+        {
+            if (atomic_load_explicit(&linvoke->queue.policy, memory_order_relaxed) != LINVOKE_OVERFLOW_BLOCK)
+            {
+                // The event is dropped by the post queue, but it also counts for the limit of its signal
+                linvoke_queue_count_dropped_newest(&linvoke->queue);
+
+                if (signal_queue != NULL)
+                {
+                    linvoke_queue_count_dropped_newest(signal_queue);
+                }
+
+                linvoke_stop_waiting_for_room(linvoke, &block, blocking_queue);
+                *status = LINVOKE_POST_DROPPED;
+                return NULL;
+            }
+
+            full_queue = &linvoke->queue;
+        }
+
+        // The time a producer waits is counted by the queue it waits for
+        if (blocking_queue != full_queue)
+        {
+            linvoke_stop_waiting_for_room(linvoke, &block, blocking_queue);
+            block = (linvoke_post_block_s) { 0 };
+            blocking_queue = full_queue;
+        }
+
+        linvoke_wait_for_room(linvoke, &block);
+    }
+
+    linvoke_stop_waiting_for_room(linvoke, &block, blocking_queue);
+
+    return record + 1;
+}
+
+static void linvoke_lock_posting(linvoke_s *const linvoke)
+{
+    // The lock only covers a few atomic operations, so the producers spin instead of sleeping
+    while (atomic_flag_test_and_set_explicit(&linvoke->posting_lock, memory_order_acquire))
+    {
+    }
+}
+
+static void linvoke_unlock_posting(linvoke_s *const linvoke)
+{
+    atomic_flag_clear_explicit(&linvoke->posting_lock, memory_order_release);
+}
+
+static void linvoke_wait_for_room(linvoke_s *const linvoke, linvoke_post_block_s *const block)
+{
+    if (block->start_time == 0)
+    {
+        block->start_time = linvoke_get_monotonic_time();
+        atomic_fetch_add_explicit(&linvoke->blocked_producer_count, 1, memory_order_relaxed);
+    }
+    else
+    {
+        linvoke_queue_sleep(&linvoke->release_sequence, block->release_sequence);
+    }
+
+    block->release_sequence = atomic_load_explicit(&linvoke->release_sequence, memory_order_relaxed);
+
+    // Pairs with the fence in linvoke_dispatch: either the next attempt sees the room that a dispatch made,
+    // or the dispatch sees this producer waiting and changes the release sequence, so the next sleep returns at once
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+static void linvoke_stop_waiting_for_room(linvoke_s *const linvoke, const linvoke_post_block_s *const block, linvoke_queue_s *const queue)
+{
+    if (block->start_time == 0)
+    {
+        return;
+    }
+
+    atomic_fetch_sub_explicit(&linvoke->blocked_producer_count, 1, memory_order_relaxed);
+    linvoke_queue_count_block(queue, linvoke_get_monotonic_time() - block->start_time);
+}
+
+static bool linvoke_dispatch_record(void *context, const linvoke_signal signal_id, void *payload)
+{
+    linvoke_s *const linvoke = context;
+    linvoke_post_header_s *const header = payload;
+
+    // Both queues have to count the event as consumed, but a dropped event is only counted by the queue that dropped it
+    const bool live = linvoke_queue_consume(&linvoke->queue, header->sequence);
+    bool signal_live = true;
+
+    if (header->signal_sequence != LINVOKE_POST_NO_SIGNAL_SEQUENCE)
+    {
+        linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
+
+        if (signal != NULL)
+        {
+            signal_live = linvoke_queue_consume(&signal->queue, header->signal_sequence);
+
+            if (live && !signal_live)
+            {
+                linvoke_queue_count_drop(&signal->queue);
+            }
+        }
+    }
+
+    if (!live)
+    {
+        linvoke_queue_count_drop(&linvoke->queue);
+    }
+
+    if (!live || !signal_live)
+    {
+        return false;
+    }
+
+    linvoke_emit(linvoke, signal_id, header + 1);
+
+    return true;
+}
+
+static uint64_t linvoke_get_monotonic_time(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (uint64_t) time.tv_sec * 1000000000u + (uint64_t) time.tv_nsec;
+}
+
+static uint32_t linvoke_hash_signal_id(const linvoke_signal signal_id)
+{
+    // Finalizer of MurmurHash3, so IDs that only differ in their high bits still spread over the index
+    uint32_t hash = signal_id;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static uint32_t linvoke_hash_slot(const linvoke_slot_s slot)
+{
+    // Functions and contexts are aligned, so the lowest bits carry little information
+    const uint64_t address = (uint64_t) (uintptr_t) slot.function ^ ((uint64_t) (uintptr_t) slot.context * 0xff51afd7ed558ccdu);
+    return (uint32_t) ((address * 0x9e3779b97f4a7c15u) >> 32);
+}
+
+static bool linvoke_is_same_slot(const linvoke_slot_s first, const linvoke_slot_s second)
+{
+    return first.function == second.function && first.context == second.context;
+}
+
+#ifndef LINVOKE_MAX_SIGNALS
+static uint32_t linvoke_round_up_to_block_size(const uint32_t value, const uint32_t block_size)
+{
+    return (value + block_size - 1) / block_size * block_size;
+}
+
+static uint32_t linvoke_round_up_to_power_of_two(const uint32_t value)
+{
+    uint32_t result = 1;
+
+    while (result < value)
+    {
+        result <<= 1;
+    }
+
+    return result;
+}
+#endif
+
+uint32_t linvoke_get_registered_signal_count(linvoke_s *const linvoke)
+{
+    return linvoke->registered_signal_count;
+}
+
+uint32_t linvoke_get_slot_count(linvoke_s *const linvoke, const linvoke_signal signal_id)
+{
+    // Find the signal with the given ID
+    linvoke_signal_data_s *const signal = linvoke_find_signal(linvoke, signal_id);
+
+    // Signal not found
+    if (signal == NULL)
+    {
+        fprintf(stderr, "Signal with id %u not found.\n", signal_id);
+        return 0;
+    }
+
+    return signal->connected_slot_count;
+}
+
+linvoke_signal linvoke_event_get_signal_id(linvoke_event_s *const event)
+{
+    return event->signal_id;
+}
+
+void *linvoke_event_get_user_data(linvoke_event_s *const event)
+{
+    return event->user_data;
+}
+
+const void *linvoke_event_get_type(linvoke_event_s *const event)
+{
+    return event->type;
+}
+
+void *linvoke_event_get_context(linvoke_event_s *const event)
+{
+    return event->context;
 }
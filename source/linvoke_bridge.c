@@ -0,0 +1,451 @@
+/**
+ * @file:      linvoke_bridge.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#define _GNU_SOURCE
+
+#include "../include/linvoke.h"
+#include "linvoke_ring.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @def LINVOKE_BRIDGE_MAGIC
+ * @brief Value at the start of the shared memory of a bridge, used to reject file descriptors that are not bridges
+ */
+#define LINVOKE_BRIDGE_MAGIC 0x4b564e4cu
+
+/**
+ * @struct linvoke_bridge_shared_s
+ * @brief The part of a bridge that lives in the shared memory. The ring buffer follows the structure directly.
+ *        The sequence numbers are futex words: a process that wants to sleep registers itself as waiting, checks
+ *        the ring once more and sleeps only if the sequence number did not change since it looked at the ring
+ * @var magic Always LINVOKE_BRIDGE_MAGIC
+ * @var receiver_sequence Futex word that is incremented when an event is committed while the receiver is waiting
+ * @var receiver_waiting Whether the receiver is sleeping, or about to sleep, in linvoke_bridge_wait
+ * @var sender_sequence Futex word that is incremented when space is reclaimed while senders are waiting
+ * @var sender_waiting_count The number of senders that are sleeping, or about to sleep, because the ring is full
+ * @var ring The ring of events, which must be the last member
+ */
+typedef struct linvoke_bridge_shared_s
+{
+    uint32_t magic;
+    _Alignas(LINVOKE_CACHE_LINE_SIZE) _Atomic uint32_t receiver_sequence;
+    _Atomic uint32_t receiver_waiting;
+    _Alignas(LINVOKE_CACHE_LINE_SIZE) _Atomic uint32_t sender_sequence;
+    _Atomic uint32_t sender_waiting_count;
+    _Alignas(LINVOKE_CACHE_LINE_SIZE) linvoke_ring_s ring;
+} linvoke_bridge_shared_s;
+
+_Static_assert(offsetof(linvoke_bridge_shared_s, ring) + sizeof(linvoke_ring_s) == sizeof(linvoke_bridge_shared_s), "The ring buffer must follow the ring directly");
+
+/**
+ * @struct linvoke_bridge_forwarder_s
+ * @brief The context of a slot that forwards the events of a signal to a bridge
+ * @var bridge The bridge that carries the events
+ * @var payload_size The number of bytes copied from the user data of each event
+ * @var next The next forwarder of the same bridge
+ */
+typedef struct linvoke_bridge_forwarder_s
+{
+    linvoke_bridge_s *bridge;
+    uint32_t payload_size;
+    struct linvoke_bridge_forwarder_s *next;
+} linvoke_bridge_forwarder_s;
+
+/**
+ * @struct linvoke_bridge_s
+ * @brief Structure that holds the mapping of a bridge in the calling process
+ * @var shared The shared memory of the bridge
+ * @var memory_size The size of the shared memory in bytes
+ * @var fd The memfd that holds the shared memory
+ * @var forwarders The contexts of the slots that forward events to the bridge, freed when the bridge is destroyed
+ */
+struct linvoke_bridge_s
+{
+    linvoke_bridge_shared_s *shared;
+    size_t memory_size;
+    int fd;
+    linvoke_bridge_forwarder_s *forwarders;
+};
+
+/**
+ * @brief Maps the shared memory of a bridge from a memfd
+ * @param fd The memfd, which is owned by the bridge from now on
+ * @param memory_size The size of the memfd in bytes
+ * @return Pointer to the bridge or NULL if the memory could not be mapped
+ */
+static linvoke_bridge_s *linvoke_bridge_map(const int fd, const size_t memory_size);
+
+/**
+ * @brief Wakes the receiver of a bridge if it is waiting for events
+ * @param bridge Pointer to a bridge
+ */
+static void linvoke_bridge_wake_receiver(linvoke_bridge_s *const bridge);
+
+/**
+ * @brief Slot that copies the payload of an event into the bridge of the forwarder in the event context
+ * @param event The event to forward
+ */
+static void linvoke_bridge_forward_slot(linvoke_event_s *event);
+
+/**
+ * @brief Ring consumer that emits every record of a bridge through the receiving linvoke object
+ * @param context Pointer to the receiving linvoke object
+ * @param signal_id The ID of the signal that emits the event
+ * @param payload The payload of the record, which is passed to the slots as the user data
+ * @return Always true
+ */
+static bool linvoke_bridge_emit_record(void *context, const linvoke_signal signal_id, void *payload);
+
+/**
+ * @brief Sleeps on a futex word in shared memory for as long as it holds an expected value
+ * @param word Pointer to the futex word
+ * @param value The value the word had when the caller decided to sleep
+ * @param timeout The maximum time to sleep or NULL to sleep until woken up
+ */
+static void linvoke_futex_wait(_Atomic uint32_t *const word, const uint32_t value, const struct timespec *const timeout);
+
+/**
+ * @brief Wakes processes that sleep on a futex word in shared memory
+ * @param word Pointer to the futex word
+ * @param count The maximum number of processes to wake up
+ */
+static void linvoke_futex_wake(_Atomic uint32_t *const word, const int count);
+
+linvoke_bridge_s *linvoke_bridge_create(const uint32_t size)
+{
+    if (size == 0 || (size & (size - 1)) != 0)
+    {
+        fprintf(stderr, "The size of a linvoke bridge must be a power of two.\n");
+        return NULL;
+    }
+
+    const int fd = memfd_create("linvoke-bridge", MFD_CLOEXEC);
+
+    if (fd < 0)
+    {
+        fprintf(stderr, "Failed to create the linvoke bridge memfd.\n");
+        return NULL;
+    }
+
+    const size_t memory_size = offsetof(linvoke_bridge_shared_s, ring) + linvoke_ring_get_memory_size(size);
+
+    if (ftruncate(fd, (off_t) memory_size) != 0)
+    {
+        fprintf(stderr, "Failed to allocate the linvoke bridge shared memory.\n");
+        close(fd);
+        return NULL;
+    }
+
+    linvoke_bridge_s *const bridge = linvoke_bridge_map(fd, memory_size);
+
+    if (bridge == NULL)
+    {
+        return NULL;
+    }
+
+    // The memfd starts zeroed, so only the non-zero parts have to be written
+    linvoke_ring_init(&bridge->shared->ring, size);
+    bridge->shared->magic = LINVOKE_BRIDGE_MAGIC;
+
+    return bridge;
+}
+
+linvoke_bridge_s *linvoke_bridge_open(const int fd)
+{
+    struct stat status;
+
+    if (fstat(fd, &status) != 0 || (size_t) status.st_size < sizeof(linvoke_bridge_shared_s))
+    {
+        fprintf(stderr, "The file descriptor %d is not a linvoke bridge.\n", fd);
+        return NULL;
+    }
+
+    const int bridge_fd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+
+    if (bridge_fd < 0)
+    {
+        fprintf(stderr, "Failed to duplicate the linvoke bridge file descriptor.\n");
+        return NULL;
+    }
+
+    linvoke_bridge_s *const bridge = linvoke_bridge_map(bridge_fd, (size_t) status.st_size);
+
+    if (bridge == NULL)
+    {
+        return NULL;
+    }
+
+    const uint64_t capacity = bridge->shared->ring.capacity;
+
+    if (bridge->shared->magic != LINVOKE_BRIDGE_MAGIC || capacity == 0 || (capacity & (capacity - 1)) != 0 ||
+        offsetof(linvoke_bridge_shared_s, ring) + linvoke_ring_get_memory_size(capacity) != bridge->memory_size)
+    {
+        fprintf(stderr, "The file descriptor %d is not a linvoke bridge.\n", fd);
+        linvoke_bridge_destroy(bridge);
+        return NULL;
+    }
+
+    return bridge;
+}
+
+void linvoke_bridge_destroy(linvoke_bridge_s *const bridge)
+{
+    linvoke_bridge_forwarder_s *forwarder = bridge->forwarders;
+
+    while (forwarder != NULL)
+    {
+        linvoke_bridge_forwarder_s *const next = forwarder->next;
+        free(forwarder);
+        forwarder = next;
+    }
+
+    munmap(bridge->shared, bridge->memory_size);
+    close(bridge->fd);
+    free(bridge);
+}
+
+int linvoke_bridge_get_fd(linvoke_bridge_s *const bridge)
+{
+    return bridge->fd;
+}
+
+void linvoke_bridge_forward(linvoke_s *const linvoke, const linvoke_signal signal_id, linvoke_bridge_s *const bridge, const uint32_t payload_size)
+{
+    // Checked once here, so the forwarding slot can wait for space without ever waiting for space that can not exist
+    if (!linvoke_ring_fits(&bridge->shared->ring, payload_size))
+    {
+        fprintf(stderr, "An event of %u bytes does not fit in the linvoke bridge.\n", payload_size);
+        return;
+    }
+
+    linvoke_bridge_forwarder_s *const forwarder = malloc(sizeof(*forwarder));
+
+    if (forwarder == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the linvoke bridge forwarder.\n");
+        return;
+    }
+
+    forwarder->bridge = bridge;
+    forwarder->payload_size = payload_size;
+    forwarder->next = bridge->forwarders;
+    bridge->forwarders = forwarder;
+
+    linvoke_connect_with_context(linvoke, signal_id, linvoke_bridge_forward_slot, forwarder);
+}
+
+void *linvoke_bridge_reserve(linvoke_bridge_s *const bridge, const linvoke_signal signal_id, const uint32_t size)
+{
+    return linvoke_ring_reserve(&bridge->shared->ring, signal_id, size);
+}
+
+void linvoke_bridge_commit(linvoke_bridge_s *const bridge, void *const payload)
+{
+    linvoke_ring_commit(payload);
+    linvoke_bridge_wake_receiver(bridge);
+}
+
+int linvoke_bridge_wait(linvoke_bridge_s *const bridge, const int timeout)
+{
+    linvoke_bridge_shared_s *const shared = bridge->shared;
+    struct timespec deadline = { 0 };
+
+    if (timeout >= 0)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += timeout / 1000;
+        deadline.tv_nsec += (long) (timeout % 1000) * 1000000;
+
+        if (deadline.tv_nsec >= 1000000000)
+        {
+            ++deadline.tv_sec;
+            deadline.tv_nsec -= 1000000000;
+        }
+    }
+
+    // A wake up that was meant for an earlier wait can end the futex wait before any new event was committed,
+    // so keep sleeping until there is an event or the timeout expires
+    while (!linvoke_ring_has_committed_record(&shared->ring))
+    {
+        struct timespec duration = { 0 };
+
+        if (timeout >= 0)
+        {
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+
+            duration.tv_sec = deadline.tv_sec - now.tv_sec;
+            duration.tv_nsec = deadline.tv_nsec - now.tv_nsec;
+
+            if (duration.tv_nsec < 0)
+            {
+                --duration.tv_sec;
+                duration.tv_nsec += 1000000000;
+            }
+
+            if (duration.tv_sec < 0)
+            {
+                return 0;
+            }
+        }
+
+        const uint32_t sequence = atomic_load_explicit(&shared->receiver_sequence, memory_order_relaxed);
+        atomic_store_explicit(&shared->receiver_waiting, 1, memory_order_relaxed);
+
+        // Pairs with the fence in linvoke_bridge_wake_receiver: either this check sees the committed event,
+        // or the sender sees the waiting flag and changes the sequence number, so the futex wait returns at once
+        atomic_thread_fence(memory_order_seq_cst);
+
+        if (!linvoke_ring_has_committed_record(&shared->ring))
+        {
+            linvoke_futex_wait(&shared->receiver_sequence, sequence, timeout < 0 ? NULL : &duration);
+        }
+
+        atomic_store_explicit(&shared->receiver_waiting, 0, memory_order_relaxed);
+    }
+
+    return 1;
+}
+
+uint32_t linvoke_bridge_dispatch(linvoke_bridge_s *const bridge, linvoke_s *const linvoke)
+{
+    linvoke_bridge_shared_s *const shared = bridge->shared;
+    const uint32_t dispatched_event_count = linvoke_ring_drain(&shared->ring, linvoke_bridge_emit_record, linvoke, UINT32_MAX, 0);
+
+    if (dispatched_event_count == 0)
+    {
+        return 0;
+    }
+
+    // Pairs with the fence in linvoke_bridge_forward_slot: either the sender sees the reclaimed space,
+    // or this process sees that the sender is waiting and wakes it up
+    atomic_thread_fence(memory_order_seq_cst);
+
+    if (atomic_load_explicit(&shared->sender_waiting_count, memory_order_relaxed) != 0)
+    {
+        atomic_fetch_add_explicit(&shared->sender_sequence, 1, memory_order_relaxed);
+        linvoke_futex_wake(&shared->sender_sequence, INT_MAX);
+    }
+
+    return dispatched_event_count;
+}
+
+static linvoke_bridge_s *linvoke_bridge_map(const int fd, const size_t memory_size)
+{
+    linvoke_bridge_s *const bridge = malloc(sizeof(*bridge));
+
+    if (bridge == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the linvoke bridge.\n");
+        close(fd);
+        return NULL;
+    }
+
+    bridge->shared = mmap(NULL, memory_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (bridge->shared == MAP_FAILED)
+    {
+        fprintf(stderr, "Failed to map the linvoke bridge shared memory.\n");
+        close(fd);
+        free(bridge);
+        return NULL;
+    }
+
+    bridge->memory_size = memory_size;
+    bridge->fd = fd;
+    bridge->forwarders = NULL;
+
+    return bridge;
+}
+
+static void linvoke_bridge_wake_receiver(linvoke_bridge_s *const bridge)
+{
+    linvoke_bridge_shared_s *const shared = bridge->shared;
+
+    // Pairs with the fence in linvoke_bridge_wait
+    atomic_thread_fence(memory_order_seq_cst);
+
+    // Senders only pay for the system call while the receiver is actually waiting
+    if (atomic_load_explicit(&shared->receiver_waiting, memory_order_relaxed) != 0)
+    {
+        atomic_fetch_add_explicit(&shared->receiver_sequence, 1, memory_order_relaxed);
+        linvoke_futex_wake(&shared->receiver_sequence, 1);
+    }
+}
+
+static void linvoke_bridge_forward_slot(linvoke_event_s *event)
+{
+    const linvoke_bridge_forwarder_s *const forwarder = linvoke_event_get_context(event);
+    linvoke_bridge_shared_s *const shared = forwarder->bridge->shared;
+    const linvoke_signal signal_id = linvoke_event_get_signal_id(event);
+    void *payload = linvoke_ring_reserve(&shared->ring, signal_id, forwarder->payload_size);
+
+    // The bridge is full, so sleep until the receiver reclaims some space
+    while (payload == NULL)
+    {
+        const uint32_t sequence = atomic_load_explicit(&shared->sender_sequence, memory_order_relaxed);
+        atomic_fetch_add_explicit(&shared->sender_waiting_count, 1, memory_order_relaxed);
+
+        // Pairs with the fence in linvoke_bridge_dispatch
+        atomic_thread_fence(memory_order_seq_cst);
+
+        payload = linvoke_ring_reserve(&shared->ring, signal_id, forwarder->payload_size);
+
+        if (payload == NULL)
+        {
+            linvoke_futex_wait(&shared->sender_sequence, sequence, NULL);
+        }
+
+        atomic_fetch_sub_explicit(&shared->sender_waiting_count, 1, memory_order_relaxed);
+    }
+
+    void *const user_data = linvoke_event_get_user_data(event);
+
+    if (user_data != NULL)
+    {
+        memcpy(payload, user_data, forwarder->payload_size);
+    }
+    else
+    {
+        memset(payload, 0, forwarder->payload_size);
+    }
+
+    linvoke_bridge_commit(forwarder->bridge, payload);
+}
+
+static bool linvoke_bridge_emit_record(void *context, const linvoke_signal signal_id, void *payload)
+{
+    linvoke_emit(context, signal_id, payload);
+    return true;
+}
+
+static void linvoke_futex_wait(_Atomic uint32_t *const word, const uint32_t value, const struct timespec *const timeout)
+{
+    // The futex is shared between processes, so the private variants of the operations can not be used
+    syscall(SYS_futex, (uint32_t *) word, FUTEX_WAIT, value, timeout, NULL, 0);
+}
+
+static void linvoke_futex_wake(_Atomic uint32_t *const word, const int count)
+{
+    syscall(SYS_futex, (uint32_t *) word, FUTEX_WAKE, count, NULL, NULL, 0);
+}
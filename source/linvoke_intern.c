@@ -0,0 +1,145 @@
+/**
+ * @file:      linvoke_intern.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include "linvoke_intern.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @def LINVOKE_INTERN_MINIMUM_CAPACITY
+ * @brief The number of entries of the hash table when the first name is interned. Must be a power of two
+ */
+#define LINVOKE_INTERN_MINIMUM_CAPACITY 16
+
+/**
+ * @brief Finds the entry of a name, or the unused entry where it would be inserted
+ * @param entries The entries of the hash table
+ * @param capacity The number of entries. Must be a power of two
+ * @param name The name
+ * @param hash The hash of the name
+ * @return A pointer to the entry
+ */
+static linvoke_intern_entry_s *linvoke_interner_probe(linvoke_intern_entry_s *const entries, const uint32_t capacity, const char *const name, const uint64_t hash);
+
+void linvoke_interner_init(linvoke_interner_s *const interner)
+{
+    interner->entries = NULL;
+    interner->capacity = 0;
+    interner->entry_count = 0;
+}
+
+void linvoke_interner_free(linvoke_interner_s *const interner)
+{
+    for (uint32_t i = 0; i < interner->capacity; ++i)
+    {
+        free(interner->entries[i].name);
+    }
+
+    free(interner->entries);
+    linvoke_interner_init(interner);
+}
+
+uint64_t linvoke_intern_hash(const char *const name)
+{
+    // 64 bit FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+
+    for (const unsigned char *character = (const unsigned char *) name; *character != '\0'; ++character)
+    {
+        hash ^= *character;
+        hash *= 1099511628211ull;
+    }
+
+    return hash != 0 ? hash : 1;
+}
+
+bool linvoke_interner_find(const linvoke_interner_s *const interner, const char *const name, const uint64_t hash, linvoke_signal *const signal_id)
+{
+    if (interner->entries == NULL)
+    {
+        return false;
+    }
+
+    const linvoke_intern_entry_s *const entry = linvoke_interner_probe(interner->entries, interner->capacity, name, hash);
+
+    if (entry->name == NULL)
+    {
+        return false;
+    }
+
+    *signal_id = entry->signal_id;
+
+    return true;
+}
+
+bool linvoke_interner_insert(linvoke_interner_s *const interner, const char *const name, const uint64_t hash, const linvoke_signal signal_id)
+{
+    // Keep the load factor at or below one half, so probe sequences stay short
+    if (2 * (interner->entry_count + 1) > interner->capacity)
+    {
+        const uint32_t capacity = interner->capacity > 0 ? 2 * interner->capacity : LINVOKE_INTERN_MINIMUM_CAPACITY;
+        linvoke_intern_entry_s *const entries = calloc(capacity, sizeof(*entries));
+
+        if (entries == NULL)
+        {
+            fprintf(stderr, "Failed to allocate memory for the linvoke signal names.\n");
+            return false;
+        }
+
+        for (uint32_t i = 0; i < interner->capacity; ++i)
+        {
+            if (interner->entries[i].name != NULL)
+            {
+                *linvoke_interner_probe(entries, capacity, interner->entries[i].name, interner->entries[i].hash) = interner->entries[i];
+            }
+        }
+
+        free(interner->entries);
+        interner->entries = entries;
+        interner->capacity = capacity;
+    }
+
+    const size_t name_size = strlen(name) + 1;
+    char *const name_copy = malloc(name_size);
+
+    if (name_copy == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the linvoke signal name %s.\n", name);
+        return false;
+    }
+
+    memcpy(name_copy, name, name_size);
+
+    linvoke_intern_entry_s *const entry = linvoke_interner_probe(interner->entries, interner->capacity, name, hash);
+    entry->hash = hash;
+    entry->name = name_copy;
+    entry->signal_id = signal_id;
+
+    ++interner->entry_count;
+
+    return true;
+}
+
+static linvoke_intern_entry_s *linvoke_interner_probe(linvoke_intern_entry_s *const entries, const uint32_t capacity, const char *const name, const uint64_t hash)
+{
+    const uint32_t mask = capacity - 1;
+    uint32_t position = (uint32_t) hash & mask;
+
+    // The full hash is compared first, so the names are only compared when they are almost certainly equal
+    while (entries[position].name != NULL && (entries[position].hash != hash || strcmp(entries[position].name, name) != 0))
+    {
+        position = (position + 1) & mask;
+    }
+
+    return &entries[position];
+}
@@ -0,0 +1,84 @@
+/**
+ * @file:      linvoke_intern.h
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#pragma once
+
+#include "../include/linvoke.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @struct linvoke_intern_entry_s
+ * @brief A signal name and the ID it was given
+ * @var hash The hash of the name
+ * @var name A copy of the name, or NULL for an unused entry
+ * @var signal_id The ID of the signal
+ */
+typedef struct linvoke_intern_entry_s
+{
+    uint64_t hash;
+    char *name;
+    linvoke_signal signal_id;
+} linvoke_intern_entry_s;
+
+/**
+ * @struct linvoke_interner_s
+ * @brief Open addressing hash table that maps signal names to IDs. Names are never removed, so their IDs stay stable
+ * @var entries The entries of the hash table. NULL until the first name is interned
+ * @var capacity The number of entries. Always a power of two
+ * @var entry_count The number of used entries
+ */
+typedef struct linvoke_interner_s
+{
+    linvoke_intern_entry_s *entries;
+    uint32_t capacity;
+    uint32_t entry_count;
+} linvoke_interner_s;
+
+/**
+ * @brief Initializes an empty interner
+ * @param interner Pointer to the interner
+ */
+void linvoke_interner_init(linvoke_interner_s *const interner);
+
+/**
+ * @brief Frees the names and the hash table of an interner
+ * @param interner Pointer to the interner
+ */
+void linvoke_interner_free(linvoke_interner_s *const interner);
+
+/**
+ * @brief Hashes a signal name. The hash is never 0, so 0 can mark a hash that was not computed yet
+ * @param name The name
+ * @return The hash of the name
+ */
+uint64_t linvoke_intern_hash(const char *const name);
+
+/**
+ * @brief Finds the ID of a signal name
+ * @param interner Pointer to the interner
+ * @param name The name
+ * @param hash The hash of the name
+ * @param signal_id Receives the ID of the signal if the name was found
+ * @return true if the name was found, false otherwise
+ */
+bool linvoke_interner_find(const linvoke_interner_s *const interner, const char *const name, const uint64_t hash, linvoke_signal *const signal_id);
+
+/**
+ * @brief Adds a signal name that is not in an interner yet
+ * @param interner Pointer to the interner
+ * @param name The name, which is copied
+ * @param hash The hash of the name
+ * @param signal_id The ID of the signal
+ * @return true if the name was added, false if the memory could not be allocated
+ */
+bool linvoke_interner_insert(linvoke_interner_s *const interner, const char *const name, const uint64_t hash, const linvoke_signal signal_id);
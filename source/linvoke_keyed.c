@@ -0,0 +1,269 @@
+/**
+ * @file:      linvoke_keyed.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include "linvoke_keyed.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @def LINVOKE_KEYED_MINIMUM_CAPACITY
+ * @brief The number of entries of the hash table when the first keyed slot is connected. Must be a power of two
+ */
+#define LINVOKE_KEYED_MINIMUM_CAPACITY 16
+
+/**
+ * @def LINVOKE_KEYED_SLOT_ARRAY_BLOCK_SIZE
+ * @brief The number of slots the slots array of a key grows by. Most keys have a single slot, so the blocks are small
+ */
+#define LINVOKE_KEYED_SLOT_ARRAY_BLOCK_SIZE 2
+
+/**
+ * @brief Finds the entry of a key, or the unused entry where it would be inserted
+ * @param entries The entries of the hash table
+ * @param capacity The number of entries. Must be a power of two
+ * @param key The key
+ * @return A pointer to the entry
+ */
+static linvoke_keyed_entry_s *linvoke_keyed_probe(linvoke_keyed_entry_s *const entries, const uint32_t capacity, const uint64_t key);
+
+/**
+ * @brief Moves the used entries of a table into a new hash table
+ * @param table Pointer to the table
+ * @param capacity The number of entries of the new hash table. Must be a power of two
+ * @return true if the hash table was rebuilt, false if the memory could not be allocated
+ */
+static bool linvoke_keyed_rebuild(linvoke_keyed_table_s *const table, const uint32_t capacity);
+
+/**
+ * @brief Hashes a key
+ * @param key The key
+ * @return The hash of the key
+ */
+static uint64_t linvoke_keyed_hash(const uint64_t key);
+
+void linvoke_keyed_init(linvoke_keyed_table_s *const table)
+{
+    table->entries = NULL;
+    table->capacity = 0;
+    table->entry_count = 0;
+}
+
+void linvoke_keyed_free(linvoke_keyed_table_s *const table)
+{
+    for (uint32_t i = 0; i < table->capacity; ++i)
+    {
+        free(table->entries[i].slots);
+    }
+
+    free(table->entries);
+    linvoke_keyed_init(table);
+}
+
+linvoke_keyed_entry_s *linvoke_keyed_find(const linvoke_keyed_table_s *const table, const uint64_t key)
+{
+    if (table->entries == NULL)
+    {
+        return NULL;
+    }
+
+    linvoke_keyed_entry_s *const entry = linvoke_keyed_probe(table->entries, table->capacity, key);
+
+    return entry->used ? entry : NULL;
+}
+
+bool linvoke_keyed_connect(linvoke_keyed_table_s *const table, const uint64_t key, const linvoke_keyed_slot_s slot)
+{
+    linvoke_keyed_entry_s *entry = linvoke_keyed_find(table, key);
+
+    if (entry == NULL)
+    {
+        // Keep the load factor at or below one half, so probe sequences stay short
+        if (2 * (table->entry_count + 1) > table->capacity && !linvoke_keyed_rebuild(table, table->capacity > 0 ? 2 * table->capacity : LINVOKE_KEYED_MINIMUM_CAPACITY))
+        {
+            return false;
+        }
+
+        entry = linvoke_keyed_probe(table->entries, table->capacity, key);
+        entry->key = key;
+        entry->used = true;
+
+        ++table->entry_count;
+    }
+
+    if (entry->slot_array_length == entry->slot_capacity)
+    {
+        const uint32_t slot_capacity = entry->slot_capacity + LINVOKE_KEYED_SLOT_ARRAY_BLOCK_SIZE;
+        linvoke_keyed_slot_s *const slots = realloc(entry->slots, slot_capacity * sizeof(*slots));
+
+        if (slots == NULL)
+        {
+            fprintf(stderr, "Failed to allocate memory for the keyed slots.\n");
+            return false;
+        }
+
+        entry->slots = slots;
+        entry->slot_capacity = slot_capacity;
+    }
+
+    entry->slots[entry->slot_array_length++] = slot;
+    ++entry->connected_slot_count;
+
+    return true;
+}
+
+uint32_t linvoke_keyed_find_slot(const linvoke_keyed_entry_s *const entry, const linvoke_keyed_slot_s slot)
+{
+    // A key rarely has more than a few slots, so they are scanned
+    for (uint32_t i = 0; i < entry->slot_array_length; ++i)
+    {
+        if (entry->slots[i].function == slot.function && entry->slots[i].context == slot.context)
+        {
+            return i;
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+void linvoke_keyed_compact(linvoke_keyed_table_s *const table)
+{
+    uint32_t entry_count = 0;
+
+    for (uint32_t i = 0; i < table->capacity; ++i)
+    {
+        entry_count += table->entries[i].used && table->entries[i].connected_slot_count > 0;
+    }
+
+    if (entry_count == 0)
+    {
+        linvoke_keyed_free(table);
+        return;
+    }
+
+    // Removing keys leaves holes in the probe sequences of the others, so the kept keys move to a new hash table.
+    // It is allocated first, so a failed allocation leaves everything untouched
+    uint32_t capacity = LINVOKE_KEYED_MINIMUM_CAPACITY;
+
+    while (capacity < 2 * entry_count)
+    {
+        capacity *= 2;
+    }
+
+    linvoke_keyed_entry_s *const entries = calloc(capacity, sizeof(*entries));
+
+    if (entries == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the keyed slots.\n");
+        return;
+    }
+
+    for (uint32_t i = 0; i < table->capacity; ++i)
+    {
+        linvoke_keyed_entry_s *const entry = &table->entries[i];
+
+        if (!entry->used)
+        {
+            continue;
+        }
+
+        if (entry->connected_slot_count == 0)
+        {
+            free(entry->slots);
+            continue;
+        }
+
+        // Move the connected slots to the front of the slots array, keeping their order
+        uint32_t slot_array_length = 0;
+
+        for (uint32_t j = 0; j < entry->slot_array_length; ++j)
+        {
+            if (entry->slots[j].function != NULL)
+            {
+                entry->slots[slot_array_length++] = entry->slots[j];
+            }
+        }
+
+        entry->slot_array_length = slot_array_length;
+
+        // Return the unused part of the slots array to the allocator
+        const uint32_t slot_capacity = (slot_array_length + LINVOKE_KEYED_SLOT_ARRAY_BLOCK_SIZE - 1) / LINVOKE_KEYED_SLOT_ARRAY_BLOCK_SIZE * LINVOKE_KEYED_SLOT_ARRAY_BLOCK_SIZE;
+
+        if (slot_capacity < entry->slot_capacity)
+        {
+            linvoke_keyed_slot_s *const slots = realloc(entry->slots, slot_capacity * sizeof(*slots));
+
+            // Shrinking is allowed to fail, the old array is still valid in that case
+            if (slots != NULL)
+            {
+                entry->slots = slots;
+                entry->slot_capacity = slot_capacity;
+            }
+        }
+
+        *linvoke_keyed_probe(entries, capacity, entry->key) = *entry;
+    }
+
+    free(table->entries);
+    table->entries = entries;
+    table->capacity = capacity;
+    table->entry_count = entry_count;
+}
+
+static linvoke_keyed_entry_s *linvoke_keyed_probe(linvoke_keyed_entry_s *const entries, const uint32_t capacity, const uint64_t key)
+{
+    const uint32_t mask = capacity - 1;
+    uint32_t position = (uint32_t) linvoke_keyed_hash(key) & mask;
+
+    while (entries[position].used && entries[position].key != key)
+    {
+        position = (position + 1) & mask;
+    }
+
+    return &entries[position];
+}
+
+static bool linvoke_keyed_rebuild(linvoke_keyed_table_s *const table, const uint32_t capacity)
+{
+    linvoke_keyed_entry_s *const entries = calloc(capacity, sizeof(*entries));
+
+    if (entries == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the keyed slots.\n");
+        return false;
+    }
+
+    for (uint32_t i = 0; i < table->capacity; ++i)
+    {
+        if (table->entries[i].used)
+        {
+            *linvoke_keyed_probe(entries, capacity, table->entries[i].key) = table->entries[i];
+        }
+    }
+
+    free(table->entries);
+    table->entries = entries;
+    table->capacity = capacity;
+
+    return true;
+}
+
+static uint64_t linvoke_keyed_hash(const uint64_t key)
+{
+    // Finalizer of SplitMix64, so sequential keys like order IDs spread over the whole table
+    uint64_t hash = key;
+    hash ^= hash >> 30;
+    hash *= 0xbf58476d1ce4e5b9ull;
+    hash ^= hash >> 27;
+    hash *= 0x94d049bb133111ebull;
+    hash ^= hash >> 31;
+    return hash;
+}
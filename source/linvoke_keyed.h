@@ -0,0 +1,107 @@
+/**
+ * @file:      linvoke_keyed.h
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#pragma once
+
+#include "../include/linvoke.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @struct linvoke_keyed_slot_s
+ * @brief A slot that was connected for a key
+ * @var function The function that will be called when an event with the key is emitted. NULL for a disconnected slot
+ * @var context The context that was given when the slot was connected. NULL for slots connected without one
+ */
+typedef struct linvoke_keyed_slot_s
+{
+    linvoke_slot_pointer function;
+    void *context;
+} linvoke_keyed_slot_s;
+
+/**
+ * @struct linvoke_keyed_entry_s
+ * @brief A key and the slots that were connected for it
+ * @var key The key
+ * @var used Whether the entry holds a key
+ * @var slots The slots of the key. Disconnected slots are left with a NULL function until the table is compacted
+ * @var connected_slot_count The number of slots that are currently connected for the key
+ * @var slot_array_length The number of used entries in the slots array, including the disconnected ones
+ * @var slot_capacity The maximum capacity of the slots array
+ */
+typedef struct linvoke_keyed_entry_s
+{
+    uint64_t key;
+    bool used;
+    linvoke_keyed_slot_s *slots;
+    uint32_t connected_slot_count;
+    uint32_t slot_array_length;
+    uint32_t slot_capacity;
+} linvoke_keyed_entry_s;
+
+/**
+ * @struct linvoke_keyed_table_s
+ * @brief Open addressing hash table that maps the keys of a signal to the slots connected for them.
+ *        Keys are only removed when the table is compacted, so lookups never have to probe past tombstones
+ * @var entries The entries of the hash table. NULL until the first keyed slot is connected
+ * @var capacity The number of entries. Always a power of two
+ * @var entry_count The number of used entries
+ */
+typedef struct linvoke_keyed_table_s
+{
+    linvoke_keyed_entry_s *entries;
+    uint32_t capacity;
+    uint32_t entry_count;
+} linvoke_keyed_table_s;
+
+/**
+ * @brief Initializes an empty keyed table
+ * @param table Pointer to the table
+ */
+void linvoke_keyed_init(linvoke_keyed_table_s *const table);
+
+/**
+ * @brief Frees the slots and the hash table of a keyed table, leaving it empty
+ * @param table Pointer to the table
+ */
+void linvoke_keyed_free(linvoke_keyed_table_s *const table);
+
+/**
+ * @brief Finds the entry of a key
+ * @param table Pointer to the table
+ * @param key The key
+ * @return A pointer to the entry, or NULL if no slot was ever connected for the key
+ */
+linvoke_keyed_entry_s *linvoke_keyed_find(const linvoke_keyed_table_s *const table, const uint64_t key);
+
+/**
+ * @brief Connects a slot for a key, adding the key to the table if it is not in it yet
+ * @param table Pointer to the table
+ * @param key The key
+ * @param slot The slot, which must not be connected for the key yet
+ * @return true if the slot was connected, false if the memory could not be allocated
+ */
+bool linvoke_keyed_connect(linvoke_keyed_table_s *const table, const uint64_t key, const linvoke_keyed_slot_s slot);
+
+/**
+ * @brief Finds the position of a connected slot in the slots array of a key
+ * @param entry Pointer to the entry of the key
+ * @param slot The slot
+ * @return The position of the slot, or UINT32_MAX if it is not connected for the key
+ */
+uint32_t linvoke_keyed_find_slot(const linvoke_keyed_entry_s *const entry, const linvoke_keyed_slot_s slot);
+
+/**
+ * @brief Removes the disconnected slots, and the keys without any connected slots, from a keyed table
+ * @param table Pointer to the table
+ */
+void linvoke_keyed_compact(linvoke_keyed_table_s *const table);
@@ -0,0 +1,248 @@
+/**
+ * @file:      linvoke_pool.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include "linvoke_pool.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @def LINVOKE_POOL_CHUNKS_PER_THREAD
+ * @brief The number of chunks a job is split into for each thread, so threads that finish early can take over work
+ */
+#ifndef LINVOKE_POOL_CHUNKS_PER_THREAD
+#define LINVOKE_POOL_CHUNKS_PER_THREAD 4
+#endif
+
+/**
+ * @struct linvoke_pool_s
+ * @brief A pool of worker threads that run one parallel job at a time.
+ *        Workers join a job under the mutex and the job is only closed once every worker has left it,
+ *        so a worker never touches a job that has already returned
+ * @var threads The worker threads
+ * @var worker_count The number of worker threads
+ * @var mutex Protects the job fields and the counters below
+ * @var work_condition Signaled when a job is opened or the pool is stopped
+ * @var done_condition Signaled when the last worker leaves a job
+ * @var generation Incremented for every job, so a worker joins each job at most once
+ * @var job_open Whether workers may still join the current job
+ * @var stopping Whether the workers should exit
+ * @var active_worker_count The number of workers that joined the current job and did not leave it yet
+ * @var function The function of the current job
+ * @var context The context of the current job
+ * @var item_count The number of items of the current job
+ * @var chunk_size The number of items claimed at once
+ * @var next_item The first item that was not claimed yet
+ * @var busy Whether a job is running, so nested or concurrent jobs are refused instead of waiting for it
+ */
+struct linvoke_pool_s
+{
+    pthread_t *threads;
+    uint32_t worker_count;
+    pthread_mutex_t mutex;
+    pthread_cond_t work_condition;
+    pthread_cond_t done_condition;
+    uint64_t generation;
+    bool job_open;
+    bool stopping;
+    uint32_t active_worker_count;
+    linvoke_pool_function function;
+    void *context;
+    uint32_t item_count;
+    uint32_t chunk_size;
+    _Atomic uint32_t next_item;
+    atomic_flag busy;
+};
+
+/**
+ * @brief Whether the current thread is a worker thread
+ */
+static _Thread_local bool linvoke_pool_worker_thread = false;
+
+/**
+ * @brief The main function of the worker threads
+ * @param argument Pointer to the pool
+ * @return Always NULL
+ */
+static void *linvoke_pool_worker(void *argument);
+
+/**
+ * @brief Claims and processes chunks of the current job until none are left
+ * @param pool Pointer to a pool
+ */
+static void linvoke_pool_process_chunks(linvoke_pool_s *const pool);
+
+linvoke_pool_s *linvoke_pool_create(const uint32_t worker_count)
+{
+    linvoke_pool_s *const pool = malloc(sizeof(*pool));
+
+    if (pool == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the linvoke worker pool.\n");
+        return NULL;
+    }
+
+    pool->threads = malloc(worker_count * sizeof(*pool->threads));
+
+    if (pool->threads == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the linvoke worker threads.\n");
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->work_condition, NULL);
+    pthread_cond_init(&pool->done_condition, NULL);
+    pool->generation = 0;
+    pool->job_open = false;
+    pool->stopping = false;
+    pool->active_worker_count = 0;
+    atomic_init(&pool->next_item, 0);
+    atomic_flag_clear(&pool->busy);
+
+    for (pool->worker_count = 0; pool->worker_count < worker_count; ++pool->worker_count)
+    {
+        if (pthread_create(&pool->threads[pool->worker_count], NULL, linvoke_pool_worker, pool) != 0)
+        {
+            fprintf(stderr, "Failed to create a linvoke worker thread.\n");
+            linvoke_pool_destroy(pool);
+            return NULL;
+        }
+    }
+
+    return pool;
+}
+
+void linvoke_pool_destroy(linvoke_pool_s *const pool)
+{
+    pthread_mutex_lock(&pool->mutex);
+    pool->stopping = true;
+    pthread_cond_broadcast(&pool->work_condition);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for (uint32_t i = 0; i < pool->worker_count; ++i)
+    {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->done_condition);
+    pthread_cond_destroy(&pool->work_condition);
+    pthread_mutex_destroy(&pool->mutex);
+    free(pool->threads);
+    free(pool);
+}
+
+bool linvoke_pool_run(linvoke_pool_s *const pool, const linvoke_pool_function function, void *const context, const uint32_t item_count)
+{
+    // A slot that emits a parallel signal from inside a job runs it inline, since the workers are taken
+    if (atomic_flag_test_and_set_explicit(&pool->busy, memory_order_acquire))
+    {
+        return false;
+    }
+
+    const uint32_t chunk_count = (pool->worker_count + 1) * LINVOKE_POOL_CHUNKS_PER_THREAD;
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->function = function;
+    pool->context = context;
+    pool->item_count = item_count;
+    pool->chunk_size = item_count / chunk_count > 0 ? item_count / chunk_count : 1;
+    atomic_store_explicit(&pool->next_item, 0, memory_order_relaxed);
+    pool->job_open = true;
+    ++pool->generation;
+    pthread_cond_broadcast(&pool->work_condition);
+    pthread_mutex_unlock(&pool->mutex);
+
+    // The calling thread helps with the job instead of sleeping until the workers finish it
+    linvoke_pool_process_chunks(pool);
+
+    // Every chunk is claimed, so close the job and wait for the workers that are still processing theirs
+    pthread_mutex_lock(&pool->mutex);
+    pool->job_open = false;
+
+    while (pool->active_worker_count > 0)
+    {
+        pthread_cond_wait(&pool->done_condition, &pool->mutex);
+    }
+
+    pthread_mutex_unlock(&pool->mutex);
+
+    atomic_flag_clear_explicit(&pool->busy, memory_order_release);
+
+    return true;
+}
+
+bool linvoke_pool_is_worker_thread(void)
+{
+    return linvoke_pool_worker_thread;
+}
+
+static void *linvoke_pool_worker(void *argument)
+{
+    linvoke_pool_s *const pool = argument;
+    uint64_t joined_generation = 0;
+
+    linvoke_pool_worker_thread = true;
+
+    pthread_mutex_lock(&pool->mutex);
+
+    while (true)
+    {
+        while (!pool->stopping && (!pool->job_open || pool->generation == joined_generation))
+        {
+            pthread_cond_wait(&pool->work_condition, &pool->mutex);
+        }
+
+        if (pool->stopping)
+        {
+            break;
+        }
+
+        joined_generation = pool->generation;
+        ++pool->active_worker_count;
+        pthread_mutex_unlock(&pool->mutex);
+
+        linvoke_pool_process_chunks(pool);
+
+        pthread_mutex_lock(&pool->mutex);
+
+        if (--pool->active_worker_count == 0)
+        {
+            pthread_cond_signal(&pool->done_condition);
+        }
+    }
+
+    pthread_mutex_unlock(&pool->mutex);
+
+    return NULL;
+}
+
+static void linvoke_pool_process_chunks(linvoke_pool_s *const pool)
+{
+    const uint32_t item_count = pool->item_count;
+    const uint32_t chunk_size = pool->chunk_size;
+
+    while (true)
+    {
+        const uint32_t begin = atomic_fetch_add_explicit(&pool->next_item, chunk_size, memory_order_relaxed);
+
+        if (begin >= item_count)
+        {
+            return;
+        }
+
+        const uint32_t end = item_count - begin > chunk_size ? begin + chunk_size : item_count;
+        pool->function(pool->context, begin, end);
+    }
+}
@@ -0,0 +1,58 @@
+/**
+ * @file:      linvoke_pool.h
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @struct linvoke_pool_s
+ * @brief A pool of worker threads that run one parallel job at a time
+ */
+typedef struct linvoke_pool_s linvoke_pool_s;
+
+/**
+ * @typedef linvoke_pool_function
+ * @brief Pointer to a function that processes a range of the items of a parallel job
+ */
+typedef void (*linvoke_pool_function)(void *context, const uint32_t begin, const uint32_t end);
+
+/**
+ * @brief Creates a pool of worker threads
+ * @param worker_count The number of worker threads, not counting the thread that runs the jobs
+ * @return Pointer to the created pool or NULL if it could not be created
+ */
+linvoke_pool_s *linvoke_pool_create(const uint32_t worker_count);
+
+/**
+ * @brief Stops the worker threads of a pool and frees it. No job may be running
+ * @param pool Pointer to a pool
+ */
+void linvoke_pool_destroy(linvoke_pool_s *const pool);
+
+/**
+ * @brief Splits the items of a job into chunks that are processed by the workers and the calling thread together.
+ *        Returns once every chunk was processed
+ * @param pool Pointer to a pool
+ * @param function The function that processes a chunk
+ * @param context The context passed to the function
+ * @param item_count The number of items of the job
+ * @return true if the job was run, false if the pool is already running another job, in which case nothing was processed
+ */
+bool linvoke_pool_run(linvoke_pool_s *const pool, const linvoke_pool_function function, void *const context, const uint32_t item_count);
+
+/**
+ * @brief Checks if the calling thread is a worker thread of any pool
+ * @return true if it is a worker thread, false otherwise
+ */
+bool linvoke_pool_is_worker_thread(void);
@@ -0,0 +1,336 @@
+/**
+ * @file:      linvoke_profile.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#define _GNU_SOURCE
+
+#include "linvoke_profile.h"
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @def LINVOKE_PROFILE_SUB_BUCKET_BITS
+ * @brief The number of bits below the highest set bit of a duration that select its histogram bucket.
+ *        Every power of two is split into 2^bits buckets, so a percentile is off by at most 1 / 2^bits of its value
+ */
+#define LINVOKE_PROFILE_SUB_BUCKET_BITS 3
+
+/**
+ * @def LINVOKE_PROFILE_BUCKET_COUNT
+ * @brief The number of histogram buckets, which cover every duration that fits in 64 bits
+ */
+#define LINVOKE_PROFILE_BUCKET_COUNT ((64 - LINVOKE_PROFILE_SUB_BUCKET_BITS + 1) << LINVOKE_PROFILE_SUB_BUCKET_BITS)
+
+/**
+ * @def LINVOKE_PROFILE_MINIMUM_CAPACITY
+ * @brief The initial number of entries in the hash table of a profiler. Always a power of two
+ */
+#define LINVOKE_PROFILE_MINIMUM_CAPACITY 16
+
+/**
+ * @struct linvoke_profile_entry_s
+ * @brief The samples of one slot function
+ * @var function The slot function, or NULL for an unused entry
+ * @var sample_count The number of sampled calls
+ * @var estimated_call_count The sum of the sampling rates of the sampled calls
+ * @var total_nanoseconds The sum of the durations of the sampled calls
+ * @var max_nanoseconds The longest sampled call
+ * @var histogram The number of sampled calls per logarithmic duration bucket
+ */
+typedef struct linvoke_profile_entry_s
+{
+    linvoke_slot_pointer function;
+    uint64_t sample_count;
+    uint64_t estimated_call_count;
+    uint64_t total_nanoseconds;
+    uint64_t max_nanoseconds;
+    uint32_t histogram[LINVOKE_PROFILE_BUCKET_COUNT];
+} linvoke_profile_entry_s;
+
+/**
+ * @struct linvoke_profiler_s
+ * @brief Open addressing hash table of the samples per slot function
+ * @var entries The entries of the hash table
+ * @var capacity The number of entries. Always a power of two
+ * @var entry_count The number of used entries
+ */
+struct linvoke_profiler_s
+{
+    linvoke_profile_entry_s *entries;
+    uint32_t capacity;
+    uint32_t entry_count;
+};
+
+/**
+ * @brief Finds the entry of a slot function, adding one if the function was never sampled
+ * @param profiler Pointer to a profiler
+ * @param function The slot function
+ * @return A pointer to the entry, or NULL if the hash table could not grow
+ */
+static linvoke_profile_entry_s *linvoke_profiler_find_entry(linvoke_profiler_s *const profiler, const linvoke_slot_pointer function);
+
+/**
+ * @brief Get the histogram bucket of a duration
+ * @param nanoseconds The duration
+ * @return The index of the bucket
+ */
+static uint32_t linvoke_profile_get_bucket(const uint64_t nanoseconds);
+
+/**
+ * @brief Get the largest duration that falls into a histogram bucket
+ * @param bucket The index of the bucket
+ * @return The duration in nanoseconds
+ */
+static uint64_t linvoke_profile_get_bucket_limit(const uint32_t bucket);
+
+/**
+ * @brief Finds the duration below which a given share of the samples of an entry lies
+ * @param entry Pointer to the entry
+ * @param percentile The share of the samples in percent
+ * @return The upper limit of the bucket that holds the percentile, but never more than the longest sample
+ */
+static uint64_t linvoke_profile_get_percentile(const linvoke_profile_entry_s *const entry, const double percentile);
+
+/**
+ * @brief Orders entries by the sampled time, largest first, for qsort
+ */
+static int linvoke_profile_compare_entries(const void *first, const void *second);
+
+linvoke_profiler_s *linvoke_profiler_create(void)
+{
+    linvoke_profiler_s *const profiler = malloc(sizeof(*profiler));
+
+    if (profiler == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the linvoke profiler.\n");
+        return NULL;
+    }
+
+    profiler->entries = calloc(LINVOKE_PROFILE_MINIMUM_CAPACITY, sizeof(*profiler->entries));
+
+    if (profiler->entries == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the linvoke profiler.\n");
+        free(profiler);
+        return NULL;
+    }
+
+    profiler->capacity = LINVOKE_PROFILE_MINIMUM_CAPACITY;
+    profiler->entry_count = 0;
+
+    return profiler;
+}
+
+void linvoke_profiler_destroy(linvoke_profiler_s *const profiler)
+{
+    free(profiler->entries);
+    free(profiler);
+}
+
+void linvoke_profiler_reset(linvoke_profiler_s *const profiler)
+{
+    memset(profiler->entries, 0, profiler->capacity * sizeof(*profiler->entries));
+    profiler->entry_count = 0;
+}
+
+void linvoke_profiler_add_sample(linvoke_profiler_s *const profiler, const linvoke_slot_pointer function, const uint64_t nanoseconds, const uint32_t rate)
+{
+    linvoke_profile_entry_s *const entry = linvoke_profiler_find_entry(profiler, function);
+
+    if (entry == NULL)
+    {
+        return;
+    }
+
+    ++entry->sample_count;
+    entry->estimated_call_count += rate;
+    entry->total_nanoseconds += nanoseconds;
+    entry->max_nanoseconds = nanoseconds > entry->max_nanoseconds ? nanoseconds : entry->max_nanoseconds;
+    ++entry->histogram[linvoke_profile_get_bucket(nanoseconds)];
+}
+
+void linvoke_profiler_report(const linvoke_profiler_s *const profiler, FILE *const stream, const uint32_t top_n)
+{
+    // Sort pointers to the used entries, so the hash table itself stays intact
+    const linvoke_profile_entry_s **const sorted_entries = malloc((profiler->entry_count + 1) * sizeof(*sorted_entries));
+
+    if (sorted_entries == NULL)
+    {
+        fprintf(stderr, "Failed to allocate memory for the linvoke profile report.\n");
+        return;
+    }
+
+    uint32_t entry_count = 0;
+    uint64_t total_nanoseconds = 0;
+
+    for (uint32_t i = 0; i < profiler->capacity; ++i)
+    {
+        if (profiler->entries[i].function != NULL)
+        {
+            sorted_entries[entry_count++] = &profiler->entries[i];
+            total_nanoseconds += profiler->entries[i].total_nanoseconds;
+        }
+    }
+
+    qsort(sorted_entries, entry_count, sizeof(*sorted_entries), linvoke_profile_compare_entries);
+
+    const uint32_t printed_entry_count = top_n > 0 && top_n < entry_count ? top_n : entry_count;
+
+    fprintf(stream, "%-40s %10s %12s %7s %10s %10s %10s %10s %10s\n", "slot", "samples", "est. calls", "share", "mean ns", "p50 ns", "p90 ns", "p99 ns", "max ns");
+
+    for (uint32_t i = 0; i < printed_entry_count; ++i)
+    {
+        const linvoke_profile_entry_s *const entry = sorted_entries[i];
+
+        // Exported functions are printed by name, everything else by address
+        char name[41];
+        Dl_info info;
+
+        if (dladdr(*(void **) &entry->function, &info) != 0 && info.dli_sname != NULL)
+        {
+            snprintf(name, sizeof(name), "%s", info.dli_sname);
+        }
+        else
+        {
+            snprintf(name, sizeof(name), "%p", *(void **) &entry->function);
+        }
+
+        fprintf(stream, "%-40s %10lu %12lu %6.1f%% %10lu %10lu %10lu %10lu %10lu\n",
+                name,
+                (unsigned long) entry->sample_count,
+                (unsigned long) entry->estimated_call_count,
+                total_nanoseconds > 0 ? 100.0 * (double) entry->total_nanoseconds / (double) total_nanoseconds : 0.0,
+                (unsigned long) (entry->total_nanoseconds / entry->sample_count),
+                (unsigned long) linvoke_profile_get_percentile(entry, 50),
+                (unsigned long) linvoke_profile_get_percentile(entry, 90),
+                (unsigned long) linvoke_profile_get_percentile(entry, 99),
+                (unsigned long) entry->max_nanoseconds);
+    }
+
+    free(sorted_entries);
+}
+
+static linvoke_profile_entry_s *linvoke_profiler_find_entry(linvoke_profiler_s *const profiler, const linvoke_slot_pointer function)
+{
+    // Keep the load factor at or below one half, so probe sequences stay short
+    if (2 * (profiler->entry_count + 1) > profiler->capacity)
+    {
+        const uint32_t capacity = profiler->capacity * 2;
+        linvoke_profile_entry_s *const entries = calloc(capacity, sizeof(*entries));
+
+        if (entries == NULL)
+        {
+            fprintf(stderr, "Failed to allocate memory for the linvoke profiler.\n");
+            return NULL;
+        }
+
+        for (uint32_t i = 0; i < profiler->capacity; ++i)
+        {
+            if (profiler->entries[i].function == NULL)
+            {
+                continue;
+            }
+
+            uint32_t position = (uint32_t) ((uintptr_t) profiler->entries[i].function >> 4) & (capacity - 1);
+
+            while (entries[position].function != NULL)
+            {
+                position = (position + 1) & (capacity - 1);
+            }
+
+            entries[position] = profiler->entries[i];
+        }
+
+        free(profiler->entries);
+        profiler->entries = entries;
+        profiler->capacity = capacity;
+    }
+
+    const uint32_t mask = profiler->capacity - 1;
+    uint32_t position = (uint32_t) ((uintptr_t) function >> 4) & mask;
+
+    while (profiler->entries[position].function != NULL && profiler->entries[position].function != function)
+    {
+        position = (position + 1) & mask;
+    }
+
+    linvoke_profile_entry_s *const entry = &profiler->entries[position];
+
+    if (entry->function == NULL)
+    {
+        entry->function = function;
+        ++profiler->entry_count;
+    }
+
+    return entry;
+}
+
+static uint32_t linvoke_profile_get_bucket(const uint64_t nanoseconds)
+{
+    // Durations below 2^bits get a bucket each, larger ones are split by their highest set bit and the bits below it
+    if (nanoseconds < (1u << LINVOKE_PROFILE_SUB_BUCKET_BITS))
+    {
+        return (uint32_t) nanoseconds;
+    }
+
+    const uint32_t exponent = 63 - (uint32_t) __builtin_clzll(nanoseconds);
+    const uint32_t shift = exponent - LINVOKE_PROFILE_SUB_BUCKET_BITS;
+    const uint32_t sub_bucket = (uint32_t) (nanoseconds >> shift) & ((1u << LINVOKE_PROFILE_SUB_BUCKET_BITS) - 1);
+
+    return ((shift + 1) << LINVOKE_PROFILE_SUB_BUCKET_BITS) + sub_bucket;
+}
+
+static uint64_t linvoke_profile_get_bucket_limit(const uint32_t bucket)
+{
+    if (bucket < (1u << LINVOKE_PROFILE_SUB_BUCKET_BITS))
+    {
+        return bucket;
+    }
+
+    const uint32_t shift = (bucket >> LINVOKE_PROFILE_SUB_BUCKET_BITS) - 1;
+    const uint64_t sub_bucket = bucket & ((1u << LINVOKE_PROFILE_SUB_BUCKET_BITS) - 1);
+    const uint64_t lower_limit = ((1ull << LINVOKE_PROFILE_SUB_BUCKET_BITS) | sub_bucket) << shift;
+
+    return lower_limit + ((1ull << shift) - 1);
+}
+
+static uint64_t linvoke_profile_get_percentile(const linvoke_profile_entry_s *const entry, const double percentile)
+{
+    const uint64_t rank = (uint64_t) ((double) entry->sample_count * percentile / 100.0 + 0.5);
+    uint64_t sample_count = 0;
+
+    for (uint32_t bucket = 0; bucket < LINVOKE_PROFILE_BUCKET_COUNT; ++bucket)
+    {
+        sample_count += entry->histogram[bucket];
+
+        if (sample_count >= rank && sample_count > 0)
+        {
+            const uint64_t limit = linvoke_profile_get_bucket_limit(bucket);
+            return limit < entry->max_nanoseconds ? limit : entry->max_nanoseconds;
+        }
+    }
+
+    return entry->max_nanoseconds;
+}
+
+static int linvoke_profile_compare_entries(const void *first, const void *second)
+{
+    const linvoke_profile_entry_s *const first_entry = *(const linvoke_profile_entry_s *const *) first;
+    const linvoke_profile_entry_s *const second_entry = *(const linvoke_profile_entry_s *const *) second;
+
+    if (first_entry->total_nanoseconds != second_entry->total_nanoseconds)
+    {
+        return first_entry->total_nanoseconds < second_entry->total_nanoseconds ? 1 : -1;
+    }
+
+    return 0;
+}
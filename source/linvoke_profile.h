@@ -0,0 +1,58 @@
+/**
+ * @file:      linvoke_profile.h
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#pragma once
+
+#include "../include/linvoke.h"
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @struct linvoke_profiler_s
+ * @brief Aggregates the measured durations of slot calls per slot function
+ */
+typedef struct linvoke_profiler_s linvoke_profiler_s;
+
+/**
+ * @brief Creates an empty profiler
+ * @return Pointer to the created profiler or NULL if the memory could not be allocated
+ */
+linvoke_profiler_s *linvoke_profiler_create(void);
+
+/**
+ * @brief Frees a profiler
+ * @param profiler Pointer to a profiler
+ */
+void linvoke_profiler_destroy(linvoke_profiler_s *const profiler);
+
+/**
+ * @brief Forgets every sample of a profiler
+ * @param profiler Pointer to a profiler
+ */
+void linvoke_profiler_reset(linvoke_profiler_s *const profiler);
+
+/**
+ * @brief Adds the duration of one call of a slot function to a profiler
+ * @param profiler Pointer to a profiler
+ * @param function The slot function that was called
+ * @param nanoseconds The duration of the call
+ * @param rate The sampling rate the call was sampled at, so the sample stands for that many calls
+ */
+void linvoke_profiler_add_sample(linvoke_profiler_s *const profiler, const linvoke_slot_pointer function, const uint64_t nanoseconds, const uint32_t rate);
+
+/**
+ * @brief Prints the slot functions with the most sampled time, slowest first
+ * @param profiler Pointer to a profiler
+ * @param stream The stream to print to
+ * @param top_n The number of slot functions to print, or 0 to print all of them
+ */
+void linvoke_profiler_report(const linvoke_profiler_s *const profiler, FILE *const stream, const uint32_t top_n);
@@ -0,0 +1,160 @@
+/**
+ * @file:      linvoke_queue.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#define _GNU_SOURCE
+
+#include "linvoke_queue.h"
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/**
+ * @brief Calculates the number of events of a queue that will still be dispatched
+ * @param queue Pointer to the queue
+ * @param posted_count The number of sequence numbers that were handed out before the new event
+ * @return The number of pending events
+ */
+static uint64_t linvoke_queue_get_pending_count(linvoke_queue_s *const queue, const uint64_t posted_count);
+
+void linvoke_queue_init(linvoke_queue_s *const queue)
+{
+    atomic_init(&queue->limit, 0);
+    atomic_init(&queue->policy, LINVOKE_OVERFLOW_DROP_NEWEST);
+    atomic_init(&queue->posted_count, 0);
+    atomic_init(&queue->consumed_count, 0);
+    atomic_init(&queue->live_sequence, 0);
+    atomic_init(&queue->dropped_newest_count, 0);
+    atomic_init(&queue->dropped_oldest_count, 0);
+    atomic_init(&queue->coalesced_count, 0);
+    atomic_init(&queue->blocked_count, 0);
+    atomic_init(&queue->blocked_nanoseconds, 0);
+}
+
+void linvoke_queue_set_limit(linvoke_queue_s *const queue, const uint32_t limit, const linvoke_overflow_policy policy)
+{
+    atomic_store_explicit(&queue->policy, (uint32_t) policy, memory_order_relaxed);
+    atomic_store_explicit(&queue->limit, limit, memory_order_relaxed);
+}
+
+bool linvoke_queue_has_room(linvoke_queue_s *const queue, linvoke_post_status *const status)
+{
+    const uint32_t limit = atomic_load_explicit(&queue->limit, memory_order_relaxed);
+
+    *status = LINVOKE_POST_QUEUED;
+
+    if (limit == 0 || linvoke_queue_get_pending_count(queue, atomic_load_explicit(&queue->posted_count, memory_order_relaxed)) < limit)
+    {
+        return true;
+    }
+
+    // Dropping older events only happens once the new event is admitted
+    const uint32_t policy = atomic_load_explicit(&queue->policy, memory_order_relaxed);
+
+    if (policy == LINVOKE_OVERFLOW_BLOCK)
+    {
+        return false;
+    }
+
+    if (policy == LINVOKE_OVERFLOW_DROP_NEWEST)
+    {
+        linvoke_queue_count_dropped_newest(queue);
+        *status = LINVOKE_POST_DROPPED;
+    }
+
+    return true;
+}
+
+linvoke_post_status linvoke_queue_admit(linvoke_queue_s *const queue, uint64_t *const sequence)
+{
+    const uint32_t limit = atomic_load_explicit(&queue->limit, memory_order_relaxed);
+    const uint64_t posted_count = atomic_fetch_add_explicit(&queue->posted_count, 1, memory_order_relaxed);
+
+    *sequence = posted_count;
+
+    // Without a limit only the sequence number is needed. A queue that was found to have room can only be full here
+    // if its limit was lowered since, in which case the events that are already pending are kept
+    const uint32_t policy = atomic_load_explicit(&queue->policy, memory_order_relaxed);
+
+    if (limit == 0 || linvoke_queue_get_pending_count(queue, posted_count) < limit || (policy != LINVOKE_OVERFLOW_DROP_OLDEST && policy != LINVOKE_OVERFLOW_COALESCE))
+    {
+        return LINVOKE_POST_QUEUED;
+    }
+
+    // Drop the oldest pending event, or all of them when coalescing, by moving the live sequence past them
+    const uint64_t live_sequence = policy == LINVOKE_OVERFLOW_COALESCE ? posted_count : posted_count + 1 - limit;
+    uint64_t current_live_sequence = atomic_load_explicit(&queue->live_sequence, memory_order_relaxed);
+
+    while (current_live_sequence < live_sequence && !atomic_compare_exchange_weak_explicit(&queue->live_sequence, &current_live_sequence, live_sequence, memory_order_relaxed, memory_order_relaxed))
+    {
+    }
+
+    return LINVOKE_POST_REPLACED;
+}
+
+bool linvoke_queue_consume(linvoke_queue_s *const queue, const uint64_t sequence)
+{
+    atomic_fetch_add_explicit(&queue->consumed_count, 1, memory_order_release);
+
+    return sequence >= atomic_load_explicit(&queue->live_sequence, memory_order_relaxed);
+}
+
+void linvoke_queue_count_drop(linvoke_queue_s *const queue)
+{
+    if (atomic_load_explicit(&queue->policy, memory_order_relaxed) == LINVOKE_OVERFLOW_COALESCE)
+    {
+        atomic_fetch_add_explicit(&queue->coalesced_count, 1, memory_order_relaxed);
+    }
+    else
+    {
+        atomic_fetch_add_explicit(&queue->dropped_oldest_count, 1, memory_order_relaxed);
+    }
+}
+
+void linvoke_queue_count_dropped_newest(linvoke_queue_s *const queue)
+{
+    atomic_fetch_add_explicit(&queue->dropped_newest_count, 1, memory_order_relaxed);
+}
+
+void linvoke_queue_count_block(linvoke_queue_s *const queue, const uint64_t nanoseconds)
+{
+    atomic_fetch_add_explicit(&queue->blocked_count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&queue->blocked_nanoseconds, nanoseconds, memory_order_relaxed);
+}
+
+void linvoke_queue_get_stats(linvoke_queue_s *const queue, linvoke_queue_stats_s *const stats)
+{
+    stats->dropped_newest_count = atomic_load_explicit(&queue->dropped_newest_count, memory_order_relaxed);
+    stats->dropped_oldest_count = atomic_load_explicit(&queue->dropped_oldest_count, memory_order_relaxed);
+    stats->coalesced_count = atomic_load_explicit(&queue->coalesced_count, memory_order_relaxed);
+    stats->blocked_count = atomic_load_explicit(&queue->blocked_count, memory_order_relaxed);
+    stats->blocked_nanoseconds = atomic_load_explicit(&queue->blocked_nanoseconds, memory_order_relaxed);
+}
+
+void linvoke_queue_sleep(_Atomic uint32_t *const word, const uint32_t value)
+{
+    syscall(SYS_futex, (uint32_t *) word, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+}
+
+void linvoke_queue_wake(_Atomic uint32_t *const word)
+{
+    syscall(SYS_futex, (uint32_t *) word, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+static uint64_t linvoke_queue_get_pending_count(linvoke_queue_s *const queue, const uint64_t posted_count)
+{
+    const uint64_t consumed_count = atomic_load_explicit(&queue->consumed_count, memory_order_acquire);
+    const uint64_t live_sequence = atomic_load_explicit(&queue->live_sequence, memory_order_relaxed);
+    const uint64_t first_pending = consumed_count > live_sequence ? consumed_count : live_sequence;
+
+    return posted_count > first_pending ? posted_count - first_pending : 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file:      linvoke_queue.h
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#pragma once
+
+#include "../include/linvoke.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @struct linvoke_queue_s
+ * @brief Counts the pending events of a post queue or of one signal and applies its overflow policy.
+ *        Every admitted event gets a sequence number. Dropping pending events only raises the live sequence,
+ *        and the events below it are skipped when they are dispatched, so producers never touch records of other producers
+ * @var limit The number of events that can be pending at once, or 0 for no limit
+ * @var policy The linvoke_overflow_policy that is applied when the limit is reached
+ * @var posted_count The number of sequence numbers that were handed out, which is also the next sequence number
+ * @var consumed_count The number of events that were dispatched or skipped
+ * @var live_sequence The sequence number of the oldest event that will still be dispatched
+ * @var dropped_newest_count See linvoke_queue_stats_s
+ * @var dropped_oldest_count See linvoke_queue_stats_s
+ * @var coalesced_count See linvoke_queue_stats_s
+ * @var blocked_count See linvoke_queue_stats_s
+ * @var blocked_nanoseconds See linvoke_queue_stats_s
+ */
+typedef struct linvoke_queue_s
+{
+    _Atomic uint32_t limit;
+    _Atomic uint32_t policy;
+    _Atomic uint64_t posted_count;
+    _Atomic uint64_t consumed_count;
+    _Atomic uint64_t live_sequence;
+    _Atomic uint64_t dropped_newest_count;
+    _Atomic uint64_t dropped_oldest_count;
+    _Atomic uint64_t coalesced_count;
+    _Atomic uint64_t blocked_count;
+    _Atomic uint64_t blocked_nanoseconds;
+} linvoke_queue_s;
+
+/**
+ * @brief Initializes a queue without a limit and with zeroed counters
+ * @param queue Pointer to the queue
+ */
+void linvoke_queue_init(linvoke_queue_s *const queue);
+
+/**
+ * @brief Sets the limit and the overflow policy of a queue. Events that are already pending are not affected
+ * @param queue Pointer to the queue
+ * @param limit The number of events that can be pending at once, or 0 for no limit
+ * @param policy The overflow policy
+ */
+void linvoke_queue_set_limit(linvoke_queue_s *const queue, const uint32_t limit, const linvoke_overflow_policy policy);
+
+/**
+ * @brief Checks if a queue can take a new event, dropping the new event if the queue is full and drops the newest events.
+ *        Only admissions can make a queue fuller, so the result holds until the next admission
+ * @param queue Pointer to the queue
+ * @param status Receives LINVOKE_POST_DROPPED if the new event was dropped, LINVOKE_POST_QUEUED otherwise
+ * @return false if the queue is full and the caller has to wait for a dispatch before trying again, true otherwise
+ */
+bool linvoke_queue_has_room(linvoke_queue_s *const queue, linvoke_post_status *const status);
+
+/**
+ * @brief Admits a new event to a queue that has room for it, dropping older pending events if the overflow policy makes
+ *        room that way. Admissions to the same queue must not run at the same time
+ * @param queue Pointer to the queue
+ * @param sequence Receives the sequence number of the admitted event
+ * @return LINVOKE_POST_REPLACED if older events made room for the new one, LINVOKE_POST_QUEUED otherwise
+ */
+linvoke_post_status linvoke_queue_admit(linvoke_queue_s *const queue, uint64_t *const sequence);
+
+/**
+ * @brief Marks an event as dispatched. Called only by the consumer
+ * @param queue Pointer to the queue
+ * @param sequence The sequence number of the event
+ * @return true if the event should be emitted, false if it was dropped while it was pending
+ */
+bool linvoke_queue_consume(linvoke_queue_s *const queue, const uint64_t sequence);
+
+/**
+ * @brief Counts a pending event that was dropped, as a dropped oldest or a coalesced event depending on the policy
+ * @param queue Pointer to the queue
+ */
+void linvoke_queue_count_drop(linvoke_queue_s *const queue);
+
+/**
+ * @brief Counts a new event that was dropped before it was admitted
+ * @param queue Pointer to the queue
+ */
+void linvoke_queue_count_dropped_newest(linvoke_queue_s *const queue);
+
+/**
+ * @brief Counts a producer that had to wait for room in a queue
+ * @param queue Pointer to the queue
+ * @param nanoseconds The time the producer waited
+ */
+void linvoke_queue_count_block(linvoke_queue_s *const queue, const uint64_t nanoseconds);
+
+/**
+ * @brief Get the overflow counters of a queue
+ * @param queue Pointer to the queue
+ * @param stats Pointer to the structure that receives the counters
+ */
+void linvoke_queue_get_stats(linvoke_queue_s *const queue, linvoke_queue_stats_s *const stats);
+
+/**
+ * @brief Sleeps for as long as a word of this process holds an expected value
+ * @param word Pointer to the word
+ * @param value The expected value
+ */
+void linvoke_queue_sleep(_Atomic uint32_t *const word, const uint32_t value);
+
+/**
+ * @brief Wakes every thread that sleeps on a word
+ * @param word Pointer to the word
+ */
+void linvoke_queue_wake(_Atomic uint32_t *const word);
@@ -0,0 +1,286 @@
+/**
+ * @file:      linvoke_record.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#define _GNU_SOURCE
+
+#include "linvoke_record.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @def LINVOKE_LOG_INITIAL_CAPACITY
+ * @brief The size of the log file mapping when recording starts. The mapping doubles whenever it is full
+ */
+#ifndef LINVOKE_LOG_INITIAL_CAPACITY
+#define LINVOKE_LOG_INITIAL_CAPACITY (1 << 20)
+#endif
+
+/**
+ * @brief Grows the log file and its mapping, so a given number of bytes can be appended
+ * @param recorder Pointer to a recorder that is recording
+ * @param length The number of bytes that will be appended
+ * @return true if there is enough space, false if the file or the mapping could not grow
+ */
+static bool linvoke_recorder_reserve(linvoke_recorder_s *const recorder, const uint64_t length);
+
+/**
+ * @brief Get the time of the monotonic clock
+ * @return The time in nanoseconds
+ */
+static uint64_t linvoke_get_monotonic_time(void);
+
+/**
+ * @brief Sleeps until the monotonic clock reaches a given time
+ * @param time The time in nanoseconds
+ */
+static void linvoke_sleep_until(const uint64_t time);
+
+void linvoke_recorder_init(linvoke_recorder_s *const recorder)
+{
+    atomic_flag_clear(&recorder->lock);
+    recorder->fd = -1;
+    recorder->memory = NULL;
+    recorder->length = 0;
+    recorder->capacity = 0;
+}
+
+bool linvoke_recorder_open(linvoke_recorder_s *const recorder, const char *const path)
+{
+    const int fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+    if (fd < 0)
+    {
+        fprintf(stderr, "Failed to create the event log %s.\n", path);
+        return false;
+    }
+
+    if (ftruncate(fd, LINVOKE_LOG_INITIAL_CAPACITY) != 0)
+    {
+        fprintf(stderr, "Failed to allocate space for the event log %s.\n", path);
+        close(fd);
+        return false;
+    }
+
+    uint8_t *const memory = mmap(NULL, LINVOKE_LOG_INITIAL_CAPACITY, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (memory == MAP_FAILED)
+    {
+        fprintf(stderr, "Failed to map the event log %s.\n", path);
+        close(fd);
+        return false;
+    }
+
+    linvoke_log_header_s *const header = (linvoke_log_header_s *) memory;
+    memcpy(header->magic, LINVOKE_LOG_MAGIC, sizeof(header->magic));
+    header->length = sizeof(*header);
+
+    recorder->fd = fd;
+    recorder->memory = memory;
+    recorder->length = sizeof(*header);
+    recorder->capacity = LINVOKE_LOG_INITIAL_CAPACITY;
+
+    return true;
+}
+
+void linvoke_recorder_close(linvoke_recorder_s *const recorder)
+{
+    if (recorder->fd < 0)
+    {
+        return;
+    }
+
+    // The file grows ahead of the records, so the unused tail is cut off
+    munmap(recorder->memory, recorder->capacity);
+
+    if (ftruncate(recorder->fd, (off_t) recorder->length) != 0)
+    {
+        fprintf(stderr, "Failed to trim the event log.\n");
+    }
+
+    close(recorder->fd);
+    linvoke_recorder_init(recorder);
+}
+
+void linvoke_recorder_append(linvoke_recorder_s *const recorder, const linvoke_signal signal_id, const void *const payload, const uint32_t payload_size)
+{
+    const uint64_t length = linvoke_log_record_length(payload_size);
+
+    // The records are short copies, so the threads spin instead of sleeping
+    while (atomic_flag_test_and_set_explicit(&recorder->lock, memory_order_acquire))
+    {
+    }
+
+    if (!linvoke_recorder_reserve(recorder, length))
+    {
+        atomic_flag_clear_explicit(&recorder->lock, memory_order_release);
+        return;
+    }
+
+    linvoke_log_record_s *const record = (linvoke_log_record_s *) (recorder->memory + recorder->length);
+    record->timestamp = linvoke_get_monotonic_time();
+    record->signal_id = signal_id;
+    record->payload_size = payload_size;
+
+    if (payload_size > 0)
+    {
+        memcpy(record + 1, payload, payload_size);
+    }
+
+    // The file and the mapping start zeroed, so the padding after the payload is already zero.
+    // The record is committed only once it is complete, so the log stays readable if the process dies at any point
+    recorder->length += length;
+    ((linvoke_log_header_s *) recorder->memory)->length = recorder->length;
+
+    atomic_flag_clear_explicit(&recorder->lock, memory_order_release);
+}
+
+uint64_t linvoke_log_record_length(const uint32_t payload_size)
+{
+    const uint64_t alignment = LINVOKE_LOG_ALIGNMENT;
+    return sizeof(linvoke_log_record_s) + (((uint64_t) payload_size + alignment - 1) & ~(alignment - 1));
+}
+
+uint32_t linvoke_replay(linvoke_s *const linvoke, const char *const path, const double speed)
+{
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+    {
+        fprintf(stderr, "Failed to open the event log %s.\n", path);
+        return 0;
+    }
+
+    struct stat status;
+
+    if (fstat(fd, &status) != 0 || (size_t) status.st_size < sizeof(linvoke_log_header_s))
+    {
+        fprintf(stderr, "The file %s is not an event log.\n", path);
+        close(fd);
+        return 0;
+    }
+
+    const uint64_t size = (uint64_t) status.st_size;
+    uint8_t *const memory = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (memory == MAP_FAILED)
+    {
+        fprintf(stderr, "Failed to map the event log %s.\n", path);
+        return 0;
+    }
+
+    const linvoke_log_header_s *const header = (const linvoke_log_header_s *) memory;
+
+    if (memcmp(header->magic, LINVOKE_LOG_MAGIC, sizeof(header->magic)) != 0 || header->length < sizeof(*header))
+    {
+        fprintf(stderr, "The file %s is not an event log.\n", path);
+        munmap(memory, size);
+        return 0;
+    }
+
+    // The file of a log that was never closed is longer than its records and ends with zeros,
+    // while a log that was cut off after it was written is shorter than its committed length
+    const uint64_t end = header->length < size ? header->length : size;
+    const uint64_t start_time = linvoke_get_monotonic_time();
+    uint64_t first_timestamp = 0;
+    uint64_t position = sizeof(linvoke_log_header_s);
+    uint32_t replayed_event_count = 0;
+
+    while (position + sizeof(linvoke_log_record_s) <= end)
+    {
+        const linvoke_log_record_s *const record = (const linvoke_log_record_s *) (memory + position);
+        const uint64_t length = linvoke_log_record_length(record->payload_size);
+
+        // A log that was cut off after it was written can end with a partial record
+        if (position + length > end)
+        {
+            break;
+        }
+
+        if (replayed_event_count == 0)
+        {
+            first_timestamp = record->timestamp;
+        }
+
+        // Keep the original distances between the events, scaled by the speed
+        if (speed > 0 && record->timestamp > first_timestamp)
+        {
+            linvoke_sleep_until(start_time + (uint64_t) ((double) (record->timestamp - first_timestamp) / speed));
+        }
+
+        // The mapping is private, so the slots may write to the payload without changing the log
+        linvoke_emit(linvoke, record->signal_id, record->payload_size > 0 ? (void *) (record + 1) : NULL);
+
+        position += length;
+        ++replayed_event_count;
+    }
+
+    munmap(memory, size);
+
+    return replayed_event_count;
+}
+
+static bool linvoke_recorder_reserve(linvoke_recorder_s *const recorder, const uint64_t length)
+{
+    if (recorder->length + length <= recorder->capacity)
+    {
+        return true;
+    }
+
+    uint64_t capacity = recorder->capacity;
+
+    while (recorder->length + length > capacity)
+    {
+        capacity *= 2;
+    }
+
+    if (ftruncate(recorder->fd, (off_t) capacity) != 0)
+    {
+        fprintf(stderr, "Failed to grow the event log.\n");
+        return false;
+    }
+
+    uint8_t *const memory = mremap(recorder->memory, recorder->capacity, capacity, MREMAP_MAYMOVE);
+
+    if (memory == MAP_FAILED)
+    {
+        fprintf(stderr, "Failed to map the grown event log.\n");
+        return false;
+    }
+
+    recorder->memory = memory;
+    recorder->capacity = capacity;
+
+    return true;
+}
+
+static uint64_t linvoke_get_monotonic_time(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (uint64_t) time.tv_sec * 1000000000u + (uint64_t) time.tv_nsec;
+}
+
+static void linvoke_sleep_until(const uint64_t time)
+{
+    const struct timespec deadline = { .tv_sec = (time_t) (time / 1000000000u), .tv_nsec = (long) (time % 1000000000u) };
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+    {
+    }
+}
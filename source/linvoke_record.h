@@ -0,0 +1,72 @@
+/**
+ * @file:      linvoke_record.h
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#pragma once
+
+#include "../include/linvoke.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @struct linvoke_recorder_s
+ * @brief Appends events to a log file through a shared memory mapping, which grows with the log
+ * @var lock Serializes the appends, which can come from several threads when the slots of parallel signals emit events
+ * @var fd The log file, or -1 if nothing is being recorded
+ * @var memory The mapping of the log file
+ * @var length The number of bytes written to the log
+ * @var capacity The size of the mapping and of the file while recording
+ */
+typedef struct linvoke_recorder_s
+{
+    atomic_flag lock;
+    int fd;
+    uint8_t *memory;
+    uint64_t length;
+    uint64_t capacity;
+} linvoke_recorder_s;
+
+/**
+ * @brief Initializes a recorder that is not recording
+ * @param recorder Pointer to the recorder
+ */
+void linvoke_recorder_init(linvoke_recorder_s *const recorder);
+
+/**
+ * @brief Creates or truncates a log file and starts recording into it
+ * @param recorder Pointer to a recorder that is not recording
+ * @param path The path of the log file
+ * @return true if the log file was created, false otherwise
+ */
+bool linvoke_recorder_open(linvoke_recorder_s *const recorder, const char *const path);
+
+/**
+ * @brief Stops recording, trimming the log file to the written records
+ * @param recorder Pointer to a recorder
+ */
+void linvoke_recorder_close(linvoke_recorder_s *const recorder);
+
+/**
+ * @brief Appends an event to the log. Can be called from several threads at once
+ * @param recorder Pointer to a recorder that is recording
+ * @param signal_id The ID of the signal that emitted the event
+ * @param payload The bytes that are copied into the log. Can be NULL if the size is 0
+ * @param payload_size The number of payload bytes
+ */
+void linvoke_recorder_append(linvoke_recorder_s *const recorder, const linvoke_signal signal_id, const void *const payload, const uint32_t payload_size);
+
+/**
+ * @brief Calculates the number of bytes a record with a given payload size occupies in the log
+ * @param payload_size The number of payload bytes
+ * @return The size of the record plus the padded payload
+ */
+uint64_t linvoke_log_record_length(const uint32_t payload_size);
@@ -0,0 +1,258 @@
+/**
+ * @file:      linvoke_ring.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include "linvoke_ring.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @def LINVOKE_RING_RECORD_BUSY
+ * @brief Header flag of a record that has been reserved, but not yet committed
+ */
+#define LINVOKE_RING_RECORD_BUSY (1u << 31)
+
+/**
+ * @def LINVOKE_RING_RECORD_PADDING
+ * @brief Header flag of a record that only fills the space up to the end of the ring buffer
+ */
+#define LINVOKE_RING_RECORD_PADDING (1u << 30)
+
+/**
+ * @def LINVOKE_RING_RECORD_SIZE_MASK
+ * @brief Mask of the header bits that hold the payload size of a record
+ */
+#define LINVOKE_RING_RECORD_SIZE_MASK (LINVOKE_RING_RECORD_PADDING - 1)
+
+/**
+ * @def LINVOKE_RING_DEADLINE_CHECK_INTERVAL
+ * @brief The number of emitted records after which a drain with a deadline reads the clock again
+ */
+#define LINVOKE_RING_DEADLINE_CHECK_INTERVAL 16
+
+/**
+ * @struct linvoke_ring_record_s
+ * @brief Header of a variable-length record in a ring. The payload follows the header directly.
+ *        A header value of 0 means that a producer has claimed the space, but has not written the header yet
+ * @var header The payload size combined with the LINVOKE_RING_RECORD_* flags
+ * @var signal_id The ID of the signal that will emit the event
+ */
+typedef struct linvoke_ring_record_s
+{
+    _Atomic uint32_t header;
+    linvoke_signal signal_id;
+} linvoke_ring_record_s;
+
+_Static_assert(sizeof(linvoke_ring_s) % sizeof(linvoke_ring_record_s) == 0, "The ring buffer must be aligned for its records");
+
+/**
+ * @brief Get the buffer of a ring, which follows the ring structure in memory
+ * @param ring Pointer to the ring
+ * @return A pointer to the first byte of the buffer
+ */
+static uint8_t *linvoke_ring_get_buffer(linvoke_ring_s *const ring);
+
+/**
+ * @brief Calculates the number of bytes a record with a given payload size occupies in the ring buffer
+ * @param size The payload size in bytes
+ * @return The size of the header plus the payload, rounded up to the alignment of the header
+ */
+static uint64_t linvoke_ring_record_length(const uint32_t size);
+
+/**
+ * @brief Checks if the monotonic clock passed a deadline
+ * @param deadline The deadline in nanoseconds
+ * @return true if the deadline passed, false otherwise
+ */
+static bool linvoke_ring_is_past_deadline(const uint64_t deadline);
+
+uint64_t linvoke_ring_get_memory_size(const uint64_t capacity)
+{
+    return sizeof(linvoke_ring_s) + capacity;
+}
+
+void linvoke_ring_init(linvoke_ring_s *const ring, const uint64_t capacity)
+{
+    ring->capacity = capacity;
+    atomic_init(&ring->write_position, 0);
+    atomic_init(&ring->release_position, 0);
+    ring->read_position = 0;
+
+    // The ring buffer must start zeroed, since a zero header marks a record that is not written yet
+    memset(linvoke_ring_get_buffer(ring), 0, capacity);
+}
+
+bool linvoke_ring_fits(const linvoke_ring_s *const ring, const uint32_t size)
+{
+    // A record that does not fit before the end of the buffer also claims the rest of it as padding. That padding is
+    // shorter than the record, so records of up to half the capacity always fit in an empty ring, wherever it starts
+    return size <= LINVOKE_RING_RECORD_SIZE_MASK && linvoke_ring_record_length(size) <= ring->capacity / 2;
+}
+
+void *linvoke_ring_reserve(linvoke_ring_s *const ring, const linvoke_signal signal_id, const uint32_t size)
+{
+    if (!linvoke_ring_fits(ring, size))
+    {
+        fprintf(stderr, "An event of %u bytes does not fit in the ring buffer.\n", size);
+        return NULL;
+    }
+
+    const uint64_t capacity = ring->capacity;
+    const uint64_t length = linvoke_ring_record_length(size);
+    uint8_t *const buffer = linvoke_ring_get_buffer(ring);
+    uint64_t position = atomic_load_explicit(&ring->write_position, memory_order_relaxed);
+    uint64_t offset;
+    uint64_t total_length;
+
+    // Claim the space by moving the write position. A record never wraps around the end of the
+    // ring buffer, so if it does not fit in the remaining space, that space is claimed as padding.
+    do
+    {
+        offset = position & (capacity - 1);
+        total_length = length;
+
+        if (offset + length > capacity)
+        {
+            total_length += capacity - offset;
+        }
+
+        const uint64_t release_position = atomic_load_explicit(&ring->release_position, memory_order_acquire);
+
+        // The ring is full
+        if (position + total_length > release_position + capacity)
+        {
+            return NULL;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&ring->write_position, &position, position + total_length, memory_order_relaxed, memory_order_relaxed));
+
+    if (total_length != length)
+    {
+        linvoke_ring_record_s *const padding = (linvoke_ring_record_s *) (buffer + offset);
+        atomic_store_explicit(&padding->header, LINVOKE_RING_RECORD_PADDING | (uint32_t) (capacity - offset), memory_order_release);
+        offset = 0;
+    }
+
+    linvoke_ring_record_s *const record = (linvoke_ring_record_s *) (buffer + offset);
+    record->signal_id = signal_id;
+    atomic_store_explicit(&record->header, LINVOKE_RING_RECORD_BUSY | size, memory_order_relaxed);
+
+    return record + 1;
+}
+
+void linvoke_ring_commit(void *const payload)
+{
+    linvoke_ring_record_s *const record = (linvoke_ring_record_s *) payload - 1;
+    const uint32_t header = atomic_load_explicit(&record->header, memory_order_relaxed);
+
+    // Publish the record together with everything that was written to the payload
+    atomic_store_explicit(&record->header, header & ~LINVOKE_RING_RECORD_BUSY, memory_order_release);
+}
+
+bool linvoke_ring_has_committed_record(linvoke_ring_s *const ring)
+{
+    if (atomic_load_explicit(&ring->write_position, memory_order_relaxed) == ring->read_position)
+    {
+        return false;
+    }
+
+    const linvoke_ring_record_s *const record = (linvoke_ring_record_s *) (linvoke_ring_get_buffer(ring) + (ring->read_position & (ring->capacity - 1)));
+    const uint32_t header = atomic_load_explicit(&record->header, memory_order_acquire);
+
+    return header != 0 && (header & LINVOKE_RING_RECORD_BUSY) == 0;
+}
+
+uint32_t linvoke_ring_drain(linvoke_ring_s *const ring, const linvoke_ring_consumer consumer, void *const context, const uint32_t max_event_count, const uint64_t deadline)
+{
+    const uint64_t capacity = ring->capacity;
+    uint8_t *const buffer = linvoke_ring_get_buffer(ring);
+
+    // Only dispatch the records that were reserved before the drain started,
+    // so producers that keep posting from the slots can not make the drain endless
+    const uint64_t write_position = atomic_load_explicit(&ring->write_position, memory_order_acquire);
+    const uint64_t start_position = ring->read_position;
+    uint64_t position = start_position;
+    uint32_t dispatched_event_count = 0;
+    uint32_t record_count = 0;
+
+    while (position != write_position && dispatched_event_count < max_event_count)
+    {
+        linvoke_ring_record_s *const record = (linvoke_ring_record_s *) (buffer + (position & (capacity - 1)));
+        const uint32_t header = atomic_load_explicit(&record->header, memory_order_acquire);
+
+        // Records are dispatched in order, so stop at the first one that is still being written
+        if (header == 0 || (header & LINVOKE_RING_RECORD_BUSY) != 0)
+        {
+            break;
+        }
+
+        if ((header & LINVOKE_RING_RECORD_PADDING) != 0)
+        {
+            position += header & LINVOKE_RING_RECORD_SIZE_MASK;
+            continue;
+        }
+
+        // Reading the clock costs about as much as emitting an event, so it is only read every few events
+        if (deadline != 0 && record_count++ % LINVOKE_RING_DEADLINE_CHECK_INTERVAL == 0 && linvoke_ring_is_past_deadline(deadline))
+        {
+            break;
+        }
+
+        if (consumer(context, record->signal_id, record + 1))
+        {
+            ++dispatched_event_count;
+        }
+
+        position += linvoke_ring_record_length(header & LINVOKE_RING_RECORD_SIZE_MASK);
+    }
+
+    if (position == start_position)
+    {
+        return 0;
+    }
+
+    // Zero the dispatched records, so stale headers are never mistaken for committed ones, then reclaim the space
+    const uint64_t start_offset = start_position & (capacity - 1);
+    const uint64_t end_offset = position & (capacity - 1);
+
+    if (start_offset < end_offset)
+    {
+        memset(buffer + start_offset, 0, end_offset - start_offset);
+    }
+    else
+    {
+        memset(buffer + start_offset, 0, capacity - start_offset);
+        memset(buffer, 0, end_offset);
+    }
+
+    ring->read_position = position;
+    atomic_store_explicit(&ring->release_position, position, memory_order_release);
+
+    return dispatched_event_count;
+}
+
+static uint8_t *linvoke_ring_get_buffer(linvoke_ring_s *const ring)
+{
+    return (uint8_t *) (ring + 1);
+}
+
+static uint64_t linvoke_ring_record_length(const uint32_t size)
+{
+    const uint64_t alignment = sizeof(linvoke_ring_record_s);
+    return sizeof(linvoke_ring_record_s) + (((uint64_t) size + alignment - 1) & ~(alignment - 1));
+}
+
+static bool linvoke_ring_is_past_deadline(const uint64_t deadline)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (uint64_t) time.tv_sec * 1000000000u + (uint64_t) time.tv_nsec >= deadline;
+}
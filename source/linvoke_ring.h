@@ -0,0 +1,109 @@
+/**
+ * @file:      linvoke_ring.h
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#pragma once
+
+#include "../include/linvoke.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @def LINVOKE_CACHE_LINE_SIZE
+ * @brief The cache line size used to keep the producer and consumer positions of a ring apart
+ */
+#ifndef LINVOKE_CACHE_LINE_SIZE
+#define LINVOKE_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * @struct linvoke_ring_s
+ * @brief Multi-producer, single-consumer ring buffer of variable-length event records.
+ *        All positions grow monotonically and are wrapped into the buffer with a mask.
+ *        The buffer follows the structure directly in memory and the structure holds no pointers,
+ *        so a ring can be placed in memory that is shared between processes
+ * @var capacity The size of the buffer in bytes. Always a power of two
+ * @var write_position The position up to which producers have reserved space
+ * @var read_position The position up to which the consumer has dispatched records
+ * @var release_position The position up to which the space has been reclaimed and can be reused by producers
+ */
+typedef struct linvoke_ring_s
+{
+    uint64_t capacity;
+    _Alignas(LINVOKE_CACHE_LINE_SIZE) _Atomic uint64_t write_position;
+    _Alignas(LINVOKE_CACHE_LINE_SIZE) uint64_t read_position;
+    _Atomic uint64_t release_position;
+} linvoke_ring_s;
+
+/**
+ * @typedef linvoke_ring_consumer
+ * @brief Pointer to a function that receives the records of a ring while it is drained
+ * @return true if the record was emitted as an event, false if it was skipped
+ */
+typedef bool (*linvoke_ring_consumer)(void *context, const linvoke_signal signal_id, void *payload);
+
+/**
+ * @brief Calculates the number of bytes a ring with a given capacity occupies, including its buffer
+ * @param capacity The size of the buffer in bytes
+ * @return The size of the ring structure plus the buffer
+ */
+uint64_t linvoke_ring_get_memory_size(const uint64_t capacity);
+
+/**
+ * @brief Initializes a ring in memory that is at least linvoke_ring_get_memory_size bytes long
+ * @param ring Pointer to the memory of the ring
+ * @param capacity The size of the buffer in bytes. Must be a power of two
+ */
+void linvoke_ring_init(linvoke_ring_s *const ring, const uint64_t capacity);
+
+/**
+ * @brief Checks if a record with a given payload size can ever fit in a ring. Records may take up to half of the buffer,
+ *        since that is the largest size that is guaranteed to fit in an empty ring at any position
+ * @param ring Pointer to the ring
+ * @param size The size of the payload in bytes
+ * @return true if the record fits in an empty ring, false otherwise
+ */
+bool linvoke_ring_fits(const linvoke_ring_s *const ring, const uint32_t size);
+
+/**
+ * @brief Reserves space for a record in a ring. Safe to call from any number of threads or processes at once
+ * @param ring Pointer to the ring
+ * @param signal_id The ID of the signal that will emit the event
+ * @param size The size of the payload in bytes
+ * @return A pointer to the payload of the record or NULL if the ring is full or the payload can never fit
+ */
+void *linvoke_ring_reserve(linvoke_ring_s *const ring, const linvoke_signal signal_id, const uint32_t size);
+
+/**
+ * @brief Publishes a record that was reserved with linvoke_ring_reserve to the consumer
+ * @param payload The pointer that was returned by linvoke_ring_reserve
+ */
+void linvoke_ring_commit(void *const payload);
+
+/**
+ * @brief Checks if the record at the read position of a ring was committed. Called only by the consumer
+ * @param ring Pointer to the ring
+ * @return true if there is a record to dispatch, false otherwise
+ */
+bool linvoke_ring_has_committed_record(linvoke_ring_s *const ring);
+
+/**
+ * @brief Passes the committed records of a ring to a consumer function, in the order in which they were reserved.
+ *        Only the records that were reserved before the call are dispatched. Called only by the consumer
+ * @param ring Pointer to the ring
+ * @param consumer The function that receives the records
+ * @param context The context that is passed to the consumer function
+ * @param max_event_count The drain stops once the consumer function emitted this many records
+ * @param deadline The drain stops once the monotonic clock passes this time in nanoseconds, or 0 for no deadline
+ * @return The number of records that the consumer function emitted
+ */
+uint32_t linvoke_ring_drain(linvoke_ring_s *const ring, const linvoke_ring_consumer consumer, void *const context, const uint32_t max_event_count, const uint64_t deadline);
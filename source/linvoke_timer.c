@@ -0,0 +1,377 @@
+/**
+ * @file:      linvoke_timer.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include "linvoke_timer.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @def LINVOKE_TIMER_NONE
+ * @brief Index of a node or a list that does not exist
+ */
+#define LINVOKE_TIMER_NONE UINT32_MAX
+
+/**
+ * @def LINVOKE_TIMER_OVERFLOW_LIST
+ * @brief The list of the timers that expire after the current block of the top level
+ */
+#define LINVOKE_TIMER_OVERFLOW_LIST (LINVOKE_TIMER_LIST_COUNT - 1)
+
+/**
+ * @def LINVOKE_TIMER_NODE_ARRAY_BLOCK_SIZE
+ * @brief The number of nodes the nodes array grows by
+ */
+#define LINVOKE_TIMER_NODE_ARRAY_BLOCK_SIZE 64
+
+/**
+ * @def LINVOKE_TIMER_WHEEL_BITS
+ * @brief The number of bits of the time covered by all levels of the timer wheel
+ */
+#define LINVOKE_TIMER_WHEEL_BITS (LINVOKE_TIMER_LEVEL_COUNT * LINVOKE_TIMER_SLOT_BITS)
+
+_Static_assert(LINVOKE_TIMER_SLOT_COUNT == 64, "The occupied slots of a level are kept in a 64 bit mask");
+
+/**
+ * @brief Puts a timer into the list that its expiry belongs to at the current time
+ * @param wheel Pointer to the timer wheel
+ * @param node_index The index of the timer, which is not in any list
+ */
+static void linvoke_timer_wheel_place(linvoke_timer_wheel_s *const wheel, const uint32_t node_index);
+
+/**
+ * @brief Appends a timer to a list, so timers with the same expiry expire in the order they were scheduled
+ * @param wheel Pointer to the timer wheel
+ * @param list The index of the list
+ * @param node_index The index of the timer, which is not in any list
+ */
+static void linvoke_timer_wheel_link(linvoke_timer_wheel_s *const wheel, const uint32_t list, const uint32_t node_index);
+
+/**
+ * @brief Removes a timer from its list
+ * @param wheel Pointer to the timer wheel
+ * @param node_index The index of the timer
+ */
+static void linvoke_timer_wheel_unlink(linvoke_timer_wheel_s *const wheel, const uint32_t node_index);
+
+/**
+ * @brief Puts the timers of a list back into the wheel, relative to the current time
+ * @param wheel Pointer to the timer wheel
+ * @param list The index of the list
+ */
+static void linvoke_timer_wheel_cascade(linvoke_timer_wheel_s *const wheel, const uint32_t list);
+
+/**
+ * @brief Returns a node to the free nodes and invalidates its handle
+ * @param wheel Pointer to the timer wheel
+ * @param node_index The index of the node, which is not in any list
+ */
+static void linvoke_timer_wheel_release(linvoke_timer_wheel_s *const wheel, const uint32_t node_index);
+
+/**
+ * @brief Finds the next time after the current time at which a slot has to be cascaded or its timers expire
+ * @param wheel Pointer to the timer wheel
+ * @param time Receives the time
+ * @return true if there is such a time, false if the wheel is empty
+ */
+static bool linvoke_timer_wheel_next_time(const linvoke_timer_wheel_s *const wheel, uint64_t *const time);
+
+void linvoke_timer_wheel_init(linvoke_timer_wheel_s *const wheel)
+{
+    wheel->nodes = NULL;
+    wheel->node_count = 0;
+    wheel->node_capacity = 0;
+    wheel->free_node = LINVOKE_TIMER_NONE;
+    wheel->overflow_expiry = UINT64_MAX;
+    wheel->current_time = 0;
+
+    for (uint32_t i = 0; i < LINVOKE_TIMER_LIST_COUNT; ++i)
+    {
+        wheel->heads[i] = LINVOKE_TIMER_NONE;
+        wheel->tails[i] = LINVOKE_TIMER_NONE;
+    }
+
+    for (uint32_t i = 0; i < LINVOKE_TIMER_LEVEL_COUNT; ++i)
+    {
+        wheel->occupied[i] = 0;
+    }
+}
+
+void linvoke_timer_wheel_free(linvoke_timer_wheel_s *const wheel)
+{
+    free(wheel->nodes);
+    linvoke_timer_wheel_init(wheel);
+}
+
+linvoke_timer linvoke_timer_wheel_add(linvoke_timer_wheel_s *const wheel, const linvoke_signal signal_id, void *const user_data, const uint64_t delay, const uint64_t period)
+{
+    uint32_t node_index = wheel->free_node;
+
+    if (node_index != LINVOKE_TIMER_NONE)
+    {
+        wheel->free_node = wheel->nodes[node_index].next;
+    }
+    else
+    {
+        if (wheel->node_count == wheel->node_capacity)
+        {
+            const uint32_t node_capacity = wheel->node_capacity + LINVOKE_TIMER_NODE_ARRAY_BLOCK_SIZE;
+            linvoke_timer_node_s *const nodes = realloc(wheel->nodes, node_capacity * sizeof(*nodes));
+
+            if (nodes == NULL)
+            {
+                fprintf(stderr, "Failed to allocate memory for the linvoke timers.\n");
+                return LINVOKE_NO_TIMER;
+            }
+
+            wheel->nodes = nodes;
+            wheel->node_capacity = node_capacity;
+        }
+
+        node_index = wheel->node_count++;
+        wheel->nodes[node_index].generation = 1;
+    }
+
+    linvoke_timer_node_s *const node = &wheel->nodes[node_index];
+    const uint64_t ticks = delay > 0 ? delay : 1;
+
+    // Timers that would expire after the end of time expire at the end of time instead
+    node->expiry = wheel->current_time + ticks >= wheel->current_time ? wheel->current_time + ticks : UINT64_MAX;
+    node->period = period;
+    node->user_data = user_data;
+    node->signal_id = signal_id;
+
+    linvoke_timer_wheel_place(wheel, node_index);
+
+    // The generation tells the handles of the timers that used the same node apart
+    return (uint64_t) node->generation << 32 | node_index;
+}
+
+bool linvoke_timer_wheel_cancel(linvoke_timer_wheel_s *const wheel, const linvoke_timer timer)
+{
+    const uint32_t node_index = (uint32_t) timer;
+    const uint32_t generation = (uint32_t) (timer >> 32);
+
+    if (node_index >= wheel->node_count || wheel->nodes[node_index].generation != generation || wheel->nodes[node_index].list == LINVOKE_TIMER_NONE)
+    {
+        return false;
+    }
+
+    linvoke_timer_wheel_unlink(wheel, node_index);
+    linvoke_timer_wheel_release(wheel, node_index);
+
+    return true;
+}
+
+uint32_t linvoke_timer_wheel_advance(linvoke_timer_wheel_s *const wheel, const uint64_t now, linvoke_timer_callback callback, void *const context)
+{
+    uint32_t expired_timer_count = 0;
+    uint64_t time;
+
+    while (linvoke_timer_wheel_next_time(wheel, &time) && time <= now)
+    {
+        wheel->current_time = time;
+
+        // The timers of a slot that the time reached belong to lower levels now, the top level first,
+        // so they can trickle all the way down to level 0 in one pass
+        if (time % ((uint64_t) 1 << LINVOKE_TIMER_WHEEL_BITS) == 0 && wheel->heads[LINVOKE_TIMER_OVERFLOW_LIST] != LINVOKE_TIMER_NONE)
+        {
+            linvoke_timer_wheel_cascade(wheel, LINVOKE_TIMER_OVERFLOW_LIST);
+        }
+
+        for (uint32_t level = LINVOKE_TIMER_LEVEL_COUNT - 1; level > 0; --level)
+        {
+            const uint32_t slot = (uint32_t) (time >> (level * LINVOKE_TIMER_SLOT_BITS)) & (LINVOKE_TIMER_SLOT_COUNT - 1);
+
+            if (wheel->occupied[level] & ((uint64_t) 1 << slot))
+            {
+                linvoke_timer_wheel_cascade(wheel, level * LINVOKE_TIMER_SLOT_COUNT + slot);
+            }
+        }
+
+        // Every timer left in the level 0 slot expires now. The timers are taken one at a time,
+        // so the callback can cancel the others
+        const uint32_t list = (uint32_t) time & (LINVOKE_TIMER_SLOT_COUNT - 1);
+
+        while (wheel->heads[list] != LINVOKE_TIMER_NONE)
+        {
+            const uint32_t node_index = wheel->heads[list];
+            linvoke_timer_node_s *const node = &wheel->nodes[node_index];
+            const linvoke_signal signal_id = node->signal_id;
+            void *const user_data = node->user_data;
+
+            linvoke_timer_wheel_unlink(wheel, node_index);
+
+            // Periodic timers are scheduled again before the callback, so it can cancel them.
+            // The next expiry is based on this one, so the period does not drift
+            if (node->period > 0 && time + node->period > time)
+            {
+                node->expiry = time + node->period;
+                linvoke_timer_wheel_place(wheel, node_index);
+            }
+            else
+            {
+                linvoke_timer_wheel_release(wheel, node_index);
+            }
+
+            callback(context, signal_id, user_data);
+            ++expired_timer_count;
+        }
+    }
+
+    if (now > wheel->current_time)
+    {
+        wheel->current_time = now;
+    }
+
+    return expired_timer_count;
+}
+
+static void linvoke_timer_wheel_place(linvoke_timer_wheel_s *const wheel, const uint32_t node_index)
+{
+    const uint64_t expiry = wheel->nodes[node_index].expiry;
+    const uint64_t differing_bits = expiry ^ wheel->current_time;
+
+    // The highest bit in which the expiry differs from the current time selects the level
+    const uint32_t level = differing_bits < LINVOKE_TIMER_SLOT_COUNT ? 0 : (uint32_t) (63 - __builtin_clzll(differing_bits)) / LINVOKE_TIMER_SLOT_BITS;
+
+    if (level >= LINVOKE_TIMER_LEVEL_COUNT)
+    {
+        linvoke_timer_wheel_link(wheel, LINVOKE_TIMER_OVERFLOW_LIST, node_index);
+        wheel->overflow_expiry = expiry < wheel->overflow_expiry ? expiry : wheel->overflow_expiry;
+        return;
+    }
+
+    const uint32_t slot = (uint32_t) (expiry >> (level * LINVOKE_TIMER_SLOT_BITS)) & (LINVOKE_TIMER_SLOT_COUNT - 1);
+
+    linvoke_timer_wheel_link(wheel, level * LINVOKE_TIMER_SLOT_COUNT + slot, node_index);
+    wheel->occupied[level] |= (uint64_t) 1 << slot;
+}
+
+static void linvoke_timer_wheel_link(linvoke_timer_wheel_s *const wheel, const uint32_t list, const uint32_t node_index)
+{
+    linvoke_timer_node_s *const node = &wheel->nodes[node_index];
+    node->list = list;
+    node->previous = wheel->tails[list];
+    node->next = LINVOKE_TIMER_NONE;
+
+    if (wheel->tails[list] != LINVOKE_TIMER_NONE)
+    {
+        wheel->nodes[wheel->tails[list]].next = node_index;
+    }
+    else
+    {
+        wheel->heads[list] = node_index;
+    }
+
+    wheel->tails[list] = node_index;
+}
+
+static void linvoke_timer_wheel_unlink(linvoke_timer_wheel_s *const wheel, const uint32_t node_index)
+{
+    linvoke_timer_node_s *const node = &wheel->nodes[node_index];
+    const uint32_t list = node->list;
+
+    if (node->previous != LINVOKE_TIMER_NONE)
+    {
+        wheel->nodes[node->previous].next = node->next;
+    }
+    else
+    {
+        wheel->heads[list] = node->next;
+    }
+
+    if (node->next != LINVOKE_TIMER_NONE)
+    {
+        wheel->nodes[node->next].previous = node->previous;
+    }
+    else
+    {
+        wheel->tails[list] = node->previous;
+    }
+
+    node->list = LINVOKE_TIMER_NONE;
+
+    if (wheel->heads[list] == LINVOKE_TIMER_NONE && list != LINVOKE_TIMER_OVERFLOW_LIST)
+    {
+        wheel->occupied[list / LINVOKE_TIMER_SLOT_COUNT] &= ~((uint64_t) 1 << (list % LINVOKE_TIMER_SLOT_COUNT));
+    }
+}
+
+static void linvoke_timer_wheel_cascade(linvoke_timer_wheel_s *const wheel, const uint32_t list)
+{
+    // The list is detached first, since its timers can end up in the same list again
+    uint32_t node_index = wheel->heads[list];
+
+    wheel->heads[list] = LINVOKE_TIMER_NONE;
+    wheel->tails[list] = LINVOKE_TIMER_NONE;
+
+    if (list != LINVOKE_TIMER_OVERFLOW_LIST)
+    {
+        wheel->occupied[list / LINVOKE_TIMER_SLOT_COUNT] &= ~((uint64_t) 1 << (list % LINVOKE_TIMER_SLOT_COUNT));
+    }
+    else
+    {
+        // The timers that stay in the overflow list set the earliest expiry again
+        wheel->overflow_expiry = UINT64_MAX;
+    }
+
+    while (node_index != LINVOKE_TIMER_NONE)
+    {
+        const uint32_t next_node_index = wheel->nodes[node_index].next;
+        linvoke_timer_wheel_place(wheel, node_index);
+        node_index = next_node_index;
+    }
+}
+
+static void linvoke_timer_wheel_release(linvoke_timer_wheel_s *const wheel, const uint32_t node_index)
+{
+    linvoke_timer_node_s *const node = &wheel->nodes[node_index];
+
+    // Generation 0 is skipped, so a handle is never LINVOKE_NO_TIMER
+    node->generation = node->generation + 1 != 0 ? node->generation + 1 : 1;
+    node->list = LINVOKE_TIMER_NONE;
+    node->next = wheel->free_node;
+    wheel->free_node = node_index;
+}
+
+static bool linvoke_timer_wheel_next_time(const linvoke_timer_wheel_s *const wheel, uint64_t *const time)
+{
+    const uint64_t current_time = wheel->current_time;
+
+    // Every timer of a level is in a slot after the current one, and the slots of lower levels come before
+    // the slots of higher levels, so the first occupied slot of the lowest level with one is the next time
+    for (uint32_t level = 0; level < LINVOKE_TIMER_LEVEL_COUNT; ++level)
+    {
+        const uint32_t shift = level * LINVOKE_TIMER_SLOT_BITS;
+        const uint32_t current_slot = (uint32_t) (current_time >> shift) & (LINVOKE_TIMER_SLOT_COUNT - 1);
+        const uint64_t later_slots = current_slot + 1 < LINVOKE_TIMER_SLOT_COUNT ? wheel->occupied[level] & (~(uint64_t) 0 << (current_slot + 1)) : 0;
+
+        if (later_slots != 0)
+        {
+            const uint64_t block_start = current_time >> (shift + LINVOKE_TIMER_SLOT_BITS) << (shift + LINVOKE_TIMER_SLOT_BITS);
+            *time = block_start | (uint64_t) __builtin_ctzll(later_slots) << shift;
+            return true;
+        }
+    }
+
+    if (wheel->heads[LINVOKE_TIMER_OVERFLOW_LIST] == LINVOKE_TIMER_NONE)
+    {
+        return false;
+    }
+
+    // The levels are empty, so the time jumps straight to the top level block of the first timer in the overflow list,
+    // however many blocks lie in between. Its timers are cascaded into the levels there. If that timer was cancelled,
+    // the block may hold no timer, and the cascade only finds the real earliest expiry
+    *time = wheel->overflow_expiry >> LINVOKE_TIMER_WHEEL_BITS << LINVOKE_TIMER_WHEEL_BITS;
+
+    return true;
+}
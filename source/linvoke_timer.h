@@ -0,0 +1,146 @@
+/**
+ * @file:      linvoke_timer.h
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#pragma once
+
+#include "../include/linvoke.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @def LINVOKE_TIMER_SLOT_BITS
+ * @brief The number of bits of the time that select the slot of one level of the timer wheel
+ */
+#define LINVOKE_TIMER_SLOT_BITS 6
+
+/**
+ * @def LINVOKE_TIMER_SLOT_COUNT
+ * @brief The number of slots of every level of the timer wheel
+ */
+#define LINVOKE_TIMER_SLOT_COUNT (1u << LINVOKE_TIMER_SLOT_BITS)
+
+/**
+ * @def LINVOKE_TIMER_LEVEL_COUNT
+ * @brief The number of levels of the timer wheel. Together they cover 2^36 ticks, timers further away than that
+ *        wait in an overflow list until the time reaches their block of 2^36 ticks
+ */
+#define LINVOKE_TIMER_LEVEL_COUNT 6
+
+/**
+ * @def LINVOKE_TIMER_LIST_COUNT
+ * @brief The number of timer lists: one for every slot of every level, and the overflow list
+ */
+#define LINVOKE_TIMER_LIST_COUNT (LINVOKE_TIMER_LEVEL_COUNT * LINVOKE_TIMER_SLOT_COUNT + 1)
+
+/**
+ * @typedef linvoke_timer_callback
+ * @brief Called for every timer that expires while the time is advanced
+ * @param context The context given to linvoke_timer_wheel_advance
+ * @param signal_id The signal of the timer
+ * @param user_data The user data of the timer
+ */
+typedef void (*linvoke_timer_callback)(void *context, const linvoke_signal signal_id, void *user_data);
+
+/**
+ * @struct linvoke_timer_node_s
+ * @brief A scheduled timer, or a free node if it is not in any list
+ * @var expiry The tick at which the timer expires next
+ * @var period The number of ticks between the expiries of a periodic timer, or 0 for a one-shot timer
+ * @var user_data The user data that is emitted with the signal
+ * @var signal_id The signal that is emitted when the timer expires
+ * @var generation Incremented whenever the node is released, so handles of released timers are rejected
+ * @var list The list that holds the timer, or UINT32_MAX for a free node
+ * @var previous The previous node in the list, or UINT32_MAX
+ * @var next The next node in the list, or UINT32_MAX. Links the free nodes as well
+ */
+typedef struct linvoke_timer_node_s
+{
+    uint64_t expiry;
+    uint64_t period;
+    void *user_data;
+    linvoke_signal signal_id;
+    uint32_t generation;
+    uint32_t list;
+    uint32_t previous;
+    uint32_t next;
+} linvoke_timer_node_s;
+
+/**
+ * @struct linvoke_timer_wheel_s
+ * @brief Hierarchical timing wheel. Level L holds the timers that expire within the current block of 64^(L+1) ticks,
+ *        but not within the current block of 64^L ticks, in the slot of the digit L of their expiry. When the time
+ *        reaches a slot of a higher level, its timers are moved down, and the timers of a level 0 slot expire
+ * @var nodes The timers, referred to by their index. NULL until the first timer is scheduled
+ * @var node_count The number of used entries in the nodes array, including the free ones
+ * @var node_capacity The maximum capacity of the nodes array
+ * @var free_node The first free node, or UINT32_MAX
+ * @var heads The first node of every list, or UINT32_MAX
+ * @var tails The last node of every list, or UINT32_MAX
+ * @var occupied A bit for every slot of every level whose list is not empty
+ * @var overflow_expiry The earliest expiry that was put into the overflow list since it was last cascaded, or UINT64_MAX.
+ *      Cancelling that timer leaves the value as it is, so it is never later than the earliest expiry in the list
+ * @var current_time The time the wheel was last advanced to
+ */
+typedef struct linvoke_timer_wheel_s
+{
+    linvoke_timer_node_s *nodes;
+    uint32_t node_count;
+    uint32_t node_capacity;
+    uint32_t free_node;
+    uint32_t heads[LINVOKE_TIMER_LIST_COUNT];
+    uint32_t tails[LINVOKE_TIMER_LIST_COUNT];
+    uint64_t occupied[LINVOKE_TIMER_LEVEL_COUNT];
+    uint64_t overflow_expiry;
+    uint64_t current_time;
+} linvoke_timer_wheel_s;
+
+/**
+ * @brief Initializes an empty timer wheel at time 0
+ * @param wheel Pointer to the timer wheel
+ */
+void linvoke_timer_wheel_init(linvoke_timer_wheel_s *const wheel);
+
+/**
+ * @brief Frees the timers of a timer wheel
+ * @param wheel Pointer to the timer wheel
+ */
+void linvoke_timer_wheel_free(linvoke_timer_wheel_s *const wheel);
+
+/**
+ * @brief Schedules a timer
+ * @param wheel Pointer to the timer wheel
+ * @param signal_id The signal that is emitted when the timer expires
+ * @param user_data The user data that is emitted with the signal
+ * @param delay The number of ticks from the current time until the timer expires. 0 is treated as 1
+ * @param period The number of ticks between later expiries, or 0 for a one-shot timer
+ * @return The handle of the timer, or LINVOKE_NO_TIMER if the memory could not be allocated
+ */
+linvoke_timer linvoke_timer_wheel_add(linvoke_timer_wheel_s *const wheel, const linvoke_signal signal_id, void *const user_data, const uint64_t delay, const uint64_t period);
+
+/**
+ * @brief Cancels a timer
+ * @param wheel Pointer to the timer wheel
+ * @param timer The handle of the timer
+ * @return true if the timer was scheduled, false if it expired already or was cancelled before
+ */
+bool linvoke_timer_wheel_cancel(linvoke_timer_wheel_s *const wheel, const linvoke_timer timer);
+
+/**
+ * @brief Advances the time of a timer wheel, calling the callback for every timer that expires on the way, in the
+ *        order of their expiries. Only the slots that hold timers are visited, so large steps cost no more than small ones
+ * @param wheel Pointer to the timer wheel
+ * @param now The new time. Times before the current time are ignored
+ * @param callback The function that is called for every expired timer. It may schedule and cancel timers
+ * @param context The context passed to the callback
+ * @return The number of expired timers
+ */
+uint32_t linvoke_timer_wheel_advance(linvoke_timer_wheel_s *const wheel, const uint64_t now, linvoke_timer_callback callback, void *const context);
@@ -11,9 +11,17 @@
  */
 
 #include <linvoke.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdbool.h>
 #include <stdarg.h>
 #include <stddef.h>
 #include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
 #include <cmocka.h>
 
 void mock_slot1(linvoke_event_s *event)
@@ -41,6 +49,100 @@ void mock_slot_with_data(linvoke_event_s *event)
     function_called();
 }
 
+uint32_t posted_payload_sum = 0;
+
+void mock_slot_with_posted_payload(linvoke_event_s *event)
+{
+    const uint32_t *payload = linvoke_event_get_user_data(event);
+
+    // The payload of the posted events is a counter, which is added up
+    // so the test can check that each event was delivered exactly once
+    posted_payload_sum += *payload;
+
+    function_called();
+}
+
+void mock_slot_unregistering_signal(linvoke_event_s *event)
+{
+    linvoke_s *linvoke = linvoke_event_get_user_data(event);
+
+    // Unregisters the signal while its slots are being called
+    linvoke_unregister_signal(linvoke, linvoke_event_get_signal_id(event));
+
+    function_called();
+}
+
+void mock_slot_with_context(linvoke_event_s *event)
+{
+    uint32_t *counter = linvoke_event_get_context(event);
+
+    // Every connection of this slot has its own counter as the context
+    ++*counter;
+
+    function_called();
+}
+
+void *called_slot_contexts[8];
+uint32_t called_slot_count = 0;
+
+void mock_slot_recording_context(linvoke_event_s *event)
+{
+    // Remembers the order in which the slots were called
+    if (called_slot_count < sizeof(called_slot_contexts) / sizeof(called_slot_contexts[0]))
+    {
+        called_slot_contexts[called_slot_count] = linvoke_event_get_context(event);
+    }
+
+    ++called_slot_count;
+}
+
+linvoke_signal dispatched_signal_ids[32];
+uint32_t dispatched_signal_count = 0;
+
+void mock_slot_recording_order(linvoke_event_s *event)
+{
+    // Remembers the order in which the signals were dispatched, so the tests can check the priority lanes
+    if (dispatched_signal_count < sizeof(dispatched_signal_ids) / sizeof(dispatched_signal_ids[0]))
+    {
+        dispatched_signal_ids[dispatched_signal_count] = linvoke_event_get_signal_id(event);
+    }
+
+    ++dispatched_signal_count;
+}
+
+uint32_t timer_expiry_mismatch_count = 0;
+
+void mock_slot_checking_expiry(linvoke_event_s *event)
+{
+    uint64_t *expiry = linvoke_event_get_user_data(event);
+
+    // Every timer carries the time it should expire at, which must be the time of the linvoke object given as the context
+    if (linvoke_get_time(linvoke_event_get_context(event)) != *expiry)
+    {
+        ++timer_expiry_mismatch_count;
+    }
+
+    // Marks the timer as expired
+    *expiry = UINT64_MAX;
+}
+
+void mock_slot_with_thread_counter(linvoke_event_s *event)
+{
+    uint32_t *counter = linvoke_event_get_context(event);
+
+    // Slots of parallel signals run on several threads, so they can not use the cmocka function call checks.
+    // Every connection has its own counter, which is only incremented by the thread that calls the slot
+    ++*counter;
+}
+
+void mock_slot_emitting_from_thread(linvoke_event_s *event)
+{
+    // The payload is recorded, so it has to stay valid until the nested emit returns
+    linvoke_s **linvoke = linvoke_event_get_context(event);
+    uint32_t value = 1;
+    linvoke_emit(*linvoke, 2, &value);
+}
+
 static void test_one_signal_one_slot(void **state)
 {
     (void) state; // unused
@@ -518,6 +620,1602 @@ static void test_one_signal_one_slot_with_data(void **state)
     linvoke_destroy(linvoke);
 }
 
+static void test_register_signals(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    linvoke_register_signal(linvoke, 3);
+
+    // Signal 3 is already registered and signal 5 appears twice, so both of them should only be registered once
+    const linvoke_signal signal_ids[] = { 1, 2, 3, 4, 5, 5 };
+    linvoke_register_signals(linvoke, signal_ids, sizeof(signal_ids) / sizeof(signal_ids[0]));
+
+    // There should be 5 signals registered
+    assert_int_equal(linvoke_get_registered_signal_count(linvoke), 5);
+
+    // Register enough signals to make the signals array and the signal index grow
+    linvoke_signal many_signal_ids[1000];
+
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        many_signal_ids[i] = 100 + i * 65536;
+    }
+
+    linvoke_register_signals(linvoke, many_signal_ids, 1000);
+
+    assert_int_equal(linvoke_get_registered_signal_count(linvoke), 1005);
+
+    // Every signal should still be reachable after the signal index grew
+    linvoke_connect(linvoke, 3, mock_slot1);
+    linvoke_connect(linvoke, many_signal_ids[999], mock_slot2);
+
+    expect_function_calls(mock_slot1, 1);
+    expect_function_calls(mock_slot2, 1);
+
+    linvoke_emit(linvoke, 3, NULL);
+    linvoke_emit(linvoke, many_signal_ids[999], NULL);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_connect_many(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 0;
+    linvoke_register_signal(linvoke, signal_id);
+
+    linvoke_connect(linvoke, signal_id, mock_slot1);
+
+    // mock_slot1 is already connected and mock_slot2 appears twice, so both of them should only be connected once
+    const linvoke_slot_pointer slots[] = { mock_slot1, mock_slot2, mock_slot2 };
+    linvoke_connect_many(linvoke, signal_id, slots, sizeof(slots) / sizeof(slots[0]));
+
+    // The signal should have 2 slots connected
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 2);
+
+    expect_function_calls(mock_slot1, 1);
+    expect_function_calls(mock_slot2, 1);
+
+    linvoke_emit(linvoke, signal_id, NULL);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_one_signal_many_slots(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 0;
+    linvoke_register_signal(linvoke, signal_id);
+
+    // Distinct slot pointers, enough to make the signal keep a hash set of its slots.
+    // They are never called, since the signal does not emit any events in this test
+    linvoke_slot_pointer slots[200];
+
+    for (uintptr_t i = 0; i < 200; ++i)
+    {
+        slots[i] = (linvoke_slot_pointer) (0x1000 + i * 16);
+    }
+
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        linvoke_connect(linvoke, signal_id, slots[i]);
+    }
+
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 100);
+
+    // Connecting the same slots again should not work
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        linvoke_connect(linvoke, signal_id, slots[i]);
+    }
+
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 100);
+
+    // Only the second half of the slots is new, so only those should get connected
+    linvoke_connect_many(linvoke, signal_id, slots, 200);
+
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 200);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_disconnect(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 0;
+    linvoke_register_signal(linvoke, signal_id);
+
+    linvoke_connect(linvoke, signal_id, mock_slot1);
+    linvoke_connect(linvoke, signal_id, mock_slot2);
+
+    linvoke_disconnect(linvoke, signal_id, mock_slot1);
+
+    // The signal should have 1 slot connected
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 1);
+
+    // This disconnect call will not work, because mock_slot1 is not connected anymore
+    linvoke_disconnect(linvoke, signal_id, mock_slot1);
+
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 1);
+
+    // Only mock_slot2 is still connected
+    expect_function_calls(mock_slot2, 1);
+    linvoke_emit(linvoke, signal_id, NULL);
+
+    // A disconnected slot can be connected again
+    linvoke_connect(linvoke, signal_id, mock_slot1);
+
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 2);
+
+    expect_function_calls(mock_slot1, 1);
+    expect_function_calls(mock_slot2, 1);
+    linvoke_emit(linvoke, signal_id, NULL);
+
+    // Compacting removes the tombstone, but keeps the connected slots
+    linvoke_compact(linvoke);
+
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 2);
+
+    expect_function_calls(mock_slot1, 1);
+    expect_function_calls(mock_slot2, 1);
+    linvoke_emit(linvoke, signal_id, NULL);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_disconnect_many_slots(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 0;
+    linvoke_register_signal(linvoke, signal_id);
+
+    // Distinct slot pointers, enough to make the signal keep a hash set of its slots.
+    // They are never called, since the signal does not emit any events in this test
+    linvoke_slot_pointer slots[100];
+
+    for (uintptr_t i = 0; i < 100; ++i)
+    {
+        slots[i] = (linvoke_slot_pointer) (0x1000 + i * 16);
+    }
+
+    linvoke_connect_many(linvoke, signal_id, slots, 100);
+
+    // Disconnect every second slot
+    for (uint32_t i = 0; i < 100; i += 2)
+    {
+        linvoke_disconnect(linvoke, signal_id, slots[i]);
+    }
+
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 50);
+
+    // The remaining slots are still detected as connected, even behind tombstones in the slot set
+    linvoke_connect_many(linvoke, signal_id, slots, 100);
+
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 100);
+
+    // Compacting the linvoke object rebuilds the slot set, which should still detect all of the slots
+    for (uint32_t i = 0; i < 100; i += 2)
+    {
+        linvoke_disconnect(linvoke, signal_id, slots[i]);
+    }
+
+    linvoke_compact(linvoke);
+
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 50);
+
+    linvoke_connect_many(linvoke, signal_id, slots, 100);
+
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 100);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_reconnect_keeps_order(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 0;
+    linvoke_register_signal(linvoke, signal_id);
+
+    // The first slot stays connected, while every other one is replaced by the next
+    uint32_t contexts[1000];
+    linvoke_connect_with_context(linvoke, signal_id, mock_slot_recording_context, &contexts[0]);
+
+    for (uint32_t i = 1; i < 1000; ++i)
+    {
+        linvoke_connect_with_context(linvoke, signal_id, mock_slot_recording_context, &contexts[i]);
+
+        if (i > 1)
+        {
+            linvoke_disconnect_with_context(linvoke, signal_id, mock_slot_recording_context, &contexts[i - 1]);
+        }
+    }
+
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 2);
+
+    // The space of the disconnected slots was reused without changing the order of the connected ones
+    called_slot_count = 0;
+    linvoke_emit(linvoke, signal_id, NULL);
+
+    assert_int_equal(called_slot_count, 2);
+    assert_ptr_equal(called_slot_contexts[0], &contexts[0]);
+    assert_ptr_equal(called_slot_contexts[1], &contexts[999]);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_unregister_signal(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal1_id = 0;
+    const linvoke_signal signal2_id = 1;
+    linvoke_register_signal(linvoke, signal1_id);
+    linvoke_register_signal(linvoke, signal2_id);
+
+    linvoke_connect(linvoke, signal1_id, mock_slot1);
+    linvoke_connect(linvoke, signal2_id, mock_slot2);
+
+    linvoke_unregister_signal(linvoke, signal1_id);
+
+    // There should be 1 signal registered
+    assert_int_equal(linvoke_get_registered_signal_count(linvoke), 1);
+
+    // This unregister call will not work, because the signal is not registered anymore
+    linvoke_unregister_signal(linvoke, signal1_id);
+
+    assert_int_equal(linvoke_get_registered_signal_count(linvoke), 1);
+
+    // Emitting the unregistered signal should not call its former slot
+    linvoke_emit(linvoke, signal1_id, NULL);
+
+    // The other signal should not be affected
+    expect_function_calls(mock_slot2, 1);
+    linvoke_emit(linvoke, signal2_id, NULL);
+
+    // The ID of an unregistered signal can be registered again, without any slots
+    linvoke_register_signal(linvoke, signal1_id);
+
+    assert_int_equal(linvoke_get_registered_signal_count(linvoke), 2);
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal1_id), 0);
+
+    // Compacting keeps both registered signals reachable
+    linvoke_compact(linvoke);
+
+    assert_int_equal(linvoke_get_registered_signal_count(linvoke), 2);
+
+    linvoke_connect(linvoke, signal1_id, mock_slot1);
+
+    expect_function_calls(mock_slot1, 1);
+    expect_function_calls(mock_slot2, 1);
+    linvoke_emit(linvoke, signal1_id, NULL);
+    linvoke_emit(linvoke, signal2_id, NULL);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_unregister_signal_from_slot(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 1;
+    const linvoke_signal keyed_signal_id = 2;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_register_signal(linvoke, keyed_signal_id);
+
+    linvoke_connect(linvoke, signal_id, mock_slot_unregistering_signal);
+    linvoke_connect(linvoke, signal_id, mock_slot2);
+    linvoke_connect(linvoke, keyed_signal_id, mock_slot_unregistering_signal);
+    linvoke_connect_keyed(linvoke, keyed_signal_id, 5, mock_slot2);
+
+    // The slot after the unregistering one is not called, since it was disconnected with the signal
+    expect_function_calls(mock_slot_unregistering_signal, 1);
+    linvoke_emit(linvoke, signal_id, linvoke);
+
+    assert_int_equal(linvoke_get_registered_signal_count(linvoke), 1);
+
+    // The same holds for the keyed slots, which are called after the unkeyed ones
+    expect_function_calls(mock_slot_unregistering_signal, 1);
+    linvoke_emit_keyed(linvoke, keyed_signal_id, 5, linvoke);
+
+    assert_int_equal(linvoke_get_registered_signal_count(linvoke), 0);
+
+    // Compacting releases the slots of the unregistered signals
+    linvoke_compact(linvoke);
+
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot2);
+
+    expect_function_calls(mock_slot2, 1);
+    linvoke_emit(linvoke, signal_id, NULL);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_connect_with_context(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 0;
+    linvoke_register_signal(linvoke, signal_id);
+
+    uint32_t first_counter = 0;
+    uint32_t second_counter = 0;
+
+    // The same function can be connected multiple times, as long as the contexts are different
+    linvoke_connect_with_context(linvoke, signal_id, mock_slot_with_context, &first_counter);
+    linvoke_connect_with_context(linvoke, signal_id, mock_slot_with_context, &second_counter);
+
+    // This connect call will not work, because the slot is already connected with the same context
+    linvoke_connect_with_context(linvoke, signal_id, mock_slot_with_context, &first_counter);
+
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 2);
+
+    expect_function_calls(mock_slot_with_context, 2);
+    linvoke_emit(linvoke, signal_id, NULL);
+
+    assert_int_equal(first_counter, 1);
+    assert_int_equal(second_counter, 1);
+
+    // Only the connection with the given context is disconnected
+    linvoke_disconnect_with_context(linvoke, signal_id, mock_slot_with_context, &first_counter);
+
+    expect_function_calls(mock_slot_with_context, 1);
+    linvoke_emit(linvoke, signal_id, NULL);
+
+    assert_int_equal(first_counter, 1);
+    assert_int_equal(second_counter, 2);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_post_and_dispatch(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 7;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot_with_posted_payload);
+
+    // Nothing was posted yet, so nothing should be dispatched
+    assert_int_equal(linvoke_dispatch(linvoke), 0);
+
+    posted_payload_sum = 0;
+
+    for (uint32_t i = 1; i <= 3; ++i)
+    {
+        uint32_t *payload = linvoke_post_reserve(linvoke, signal_id, sizeof(*payload));
+        assert_non_null(payload);
+        *payload = i;
+        linvoke_post_commit(linvoke, payload);
+    }
+
+    // The slot should not be called before the events are dispatched
+    assert_int_equal(posted_payload_sum, 0);
+
+    expect_function_calls(mock_slot_with_posted_payload, 3);
+    assert_int_equal(linvoke_dispatch(linvoke), 3);
+    assert_int_equal(posted_payload_sum, 1 + 2 + 3);
+
+    // The queue was drained, so there is nothing left to dispatch
+    assert_int_equal(linvoke_dispatch(linvoke), 0);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_post_reserve_uncommitted(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 7;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot_with_posted_payload);
+
+    posted_payload_sum = 0;
+
+    uint32_t *first = linvoke_post_reserve(linvoke, signal_id, sizeof(*first));
+    uint32_t *second = linvoke_post_reserve(linvoke, signal_id, sizeof(*second));
+    *first = 1;
+    *second = 2;
+
+    // Only the second event is committed, but events are dispatched in the order they were
+    // reserved, so the dispatch has to wait until the first one is committed as well
+    linvoke_post_commit(linvoke, second);
+    assert_int_equal(linvoke_dispatch(linvoke), 0);
+
+    linvoke_post_commit(linvoke, first);
+
+    expect_function_calls(mock_slot_with_posted_payload, 2);
+    assert_int_equal(linvoke_dispatch(linvoke), 2);
+    assert_int_equal(posted_payload_sum, 1 + 2);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_post_queue_reuses_space(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 7;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot_with_posted_payload);
+
+    // Fill the post queue with large records until it is full
+    uint32_t reserved_event_count = 0;
+
+    while (reserved_event_count < 1000)
+    {
+        uint32_t *payload = linvoke_post_reserve(linvoke, signal_id, 1000);
+
+        if (payload == NULL)
+        {
+            break;
+        }
+
+        *payload = 1;
+        linvoke_post_commit(linvoke, payload);
+        ++reserved_event_count;
+    }
+
+    // The post queue has a constant size, so it should have run out of space
+    assert_true(reserved_event_count > 0);
+    assert_true(reserved_event_count < 1000);
+
+    // Draining the queue reclaims the space, which is then reused by records that wrap around the ring buffer
+    for (uint32_t round = 0; round < 10; ++round)
+    {
+        posted_payload_sum = 0;
+
+        expect_function_calls(mock_slot_with_posted_payload, reserved_event_count);
+        assert_int_equal(linvoke_dispatch(linvoke), reserved_event_count);
+        assert_int_equal(posted_payload_sum, reserved_event_count);
+
+        for (uint32_t i = 0; i < reserved_event_count; ++i)
+        {
+            uint32_t *payload = linvoke_post_reserve(linvoke, signal_id, 900 + round);
+            assert_non_null(payload);
+            *payload = 1;
+            linvoke_post_commit(linvoke, payload);
+        }
+    }
+
+    expect_function_calls(mock_slot_with_posted_payload, reserved_event_count);
+    assert_int_equal(linvoke_dispatch(linvoke), reserved_event_count);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_post_queue_alternating_large_events(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 7;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot_with_posted_payload);
+
+    // The post queue of the default priority has 64 KiB, so events of up to almost 32 KiB are accepted
+    static uint32_t payload[40001 / sizeof(uint32_t) + 1] = { 1 };
+    const uint32_t sizes[] = { 32000, 20000, 30000, 1000, 32000 };
+
+    // Whatever position the previous events left the ring buffer at, an event that is accepted always fits in the empty queue
+    for (uint32_t round = 0; round < 20; ++round)
+    {
+        assert_int_equal(linvoke_post(linvoke, signal_id, payload, sizes[round % 5]), LINVOKE_POST_QUEUED);
+
+        expect_function_call(mock_slot_with_posted_payload);
+        assert_int_equal(linvoke_dispatch(linvoke), 1);
+    }
+
+    // Larger events are rejected as never fitting, instead of being dropped as if the queue was full
+    assert_int_equal(linvoke_post(linvoke, signal_id, payload, 40000), LINVOKE_POST_FAILED);
+    assert_int_equal(linvoke_post(linvoke, signal_id, payload, 40001), LINVOKE_POST_FAILED);
+    assert_int_equal(linvoke_dispatch(linvoke), 0);
+
+    linvoke_destroy(linvoke);
+}
+
+static bool is_fd_readable(const int fd)
+{
+    struct pollfd poll_fd = { .fd = fd, .events = POLLIN };
+    return poll(&poll_fd, 1, 0) == 1;
+}
+
+static void test_post_wakeup_fd(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 7;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot_with_posted_payload);
+
+    const int fd = linvoke_get_fd(linvoke);
+    assert_true(fd >= 0);
+
+    // The same eventfd is returned on every call
+    assert_int_equal(linvoke_get_fd(linvoke), fd);
+
+    // Nothing was posted yet, so the eventfd should not be readable
+    assert_false(is_fd_readable(fd));
+
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        uint32_t *payload = linvoke_post_reserve(linvoke, signal_id, sizeof(*payload));
+        *payload = 1;
+        linvoke_post_commit(linvoke, payload);
+    }
+
+    assert_true(is_fd_readable(fd));
+
+    // Dispatching drains the queue and resets the eventfd
+    expect_function_calls(mock_slot_with_posted_payload, 3);
+    assert_int_equal(linvoke_dispatch(linvoke), 3);
+
+    assert_false(is_fd_readable(fd));
+
+    // The next event makes the queue non-empty again, which signals the eventfd again
+    uint32_t *payload = linvoke_post_reserve(linvoke, signal_id, sizeof(*payload));
+    *payload = 1;
+    linvoke_post_commit(linvoke, payload);
+
+    assert_true(is_fd_readable(fd));
+
+    expect_function_calls(mock_slot_with_posted_payload, 1);
+    assert_int_equal(linvoke_dispatch(linvoke), 1);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_post_wakeup_fd_created_late(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 7;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot_with_posted_payload);
+
+    uint32_t *payload = linvoke_post_reserve(linvoke, signal_id, sizeof(*payload));
+    *payload = 1;
+    linvoke_post_commit(linvoke, payload);
+
+    // The event was posted before the eventfd existed, so the eventfd should be readable right away
+    const int fd = linvoke_get_fd(linvoke);
+    assert_true(is_fd_readable(fd));
+
+    expect_function_calls(mock_slot_with_posted_payload, 1);
+    assert_int_equal(linvoke_dispatch(linvoke), 1);
+
+    assert_false(is_fd_readable(fd));
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_post_queue_limit_drop_newest(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 7;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot_with_posted_payload);
+    linvoke_set_queue_limit(linvoke, 3, LINVOKE_OVERFLOW_DROP_NEWEST);
+
+    posted_payload_sum = 0;
+
+    for (uint32_t i = 1; i <= 5; ++i)
+    {
+        // Only the first three events fit, the rest are dropped
+        assert_int_equal(linvoke_post(linvoke, signal_id, &i, sizeof(i)), i <= 3 ? LINVOKE_POST_QUEUED : LINVOKE_POST_DROPPED);
+    }
+
+    expect_function_calls(mock_slot_with_posted_payload, 3);
+    assert_int_equal(linvoke_dispatch(linvoke), 3);
+    assert_int_equal(posted_payload_sum, 1 + 2 + 3);
+
+    // The dispatch made room again
+    const uint32_t payload = 10;
+    assert_int_equal(linvoke_post(linvoke, signal_id, &payload, sizeof(payload)), LINVOKE_POST_QUEUED);
+
+    expect_function_calls(mock_slot_with_posted_payload, 1);
+    assert_int_equal(linvoke_dispatch(linvoke), 1);
+
+    linvoke_queue_stats_s stats;
+    linvoke_get_queue_stats(linvoke, &stats);
+    assert_int_equal(stats.dropped_newest_count, 2);
+    assert_int_equal(stats.dropped_oldest_count, 0);
+    assert_int_equal(stats.blocked_count, 0);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_signal_queue_limit_drop_oldest_and_coalesce(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    linvoke_register_signal(linvoke, 0);
+    linvoke_register_signal(linvoke, 1);
+    linvoke_register_signal(linvoke, 2);
+    linvoke_connect(linvoke, 0, mock_slot_with_posted_payload);
+    linvoke_connect(linvoke, 1, mock_slot_with_posted_payload);
+    linvoke_connect(linvoke, 2, mock_slot_with_posted_payload);
+
+    // Signal 0 keeps its two newest events, signal 1 only its latest one and signal 2 is not limited
+    linvoke_set_signal_queue_limit(linvoke, 0, 2, LINVOKE_OVERFLOW_DROP_OLDEST);
+    linvoke_set_signal_queue_limit(linvoke, 1, 1, LINVOKE_OVERFLOW_COALESCE);
+
+    posted_payload_sum = 0;
+
+    for (uint32_t i = 1; i <= 4; ++i)
+    {
+        assert_int_equal(linvoke_post(linvoke, 0, &i, sizeof(i)), i <= 2 ? LINVOKE_POST_QUEUED : LINVOKE_POST_REPLACED);
+        assert_int_equal(linvoke_post(linvoke, 1, &i, sizeof(i)), i <= 1 ? LINVOKE_POST_QUEUED : LINVOKE_POST_REPLACED);
+        assert_int_equal(linvoke_post(linvoke, 2, &i, sizeof(i)), LINVOKE_POST_QUEUED);
+    }
+
+    expect_function_calls(mock_slot_with_posted_payload, 2 + 1 + 4);
+    assert_int_equal(linvoke_dispatch(linvoke), 2 + 1 + 4);
+    assert_int_equal(posted_payload_sum, (3 + 4) + 4 + (1 + 2 + 3 + 4));
+
+    linvoke_queue_stats_s stats;
+    linvoke_get_signal_queue_stats(linvoke, 0, &stats);
+    assert_int_equal(stats.dropped_oldest_count, 2);
+    assert_int_equal(stats.coalesced_count, 0);
+
+    linvoke_get_signal_queue_stats(linvoke, 1, &stats);
+    assert_int_equal(stats.dropped_oldest_count, 0);
+    assert_int_equal(stats.coalesced_count, 3);
+
+    // The dropped events were consumed with the dispatch, so the queues start empty again
+    const uint32_t payload = 10;
+    assert_int_equal(linvoke_post(linvoke, 0, &payload, sizeof(payload)), LINVOKE_POST_QUEUED);
+    assert_int_equal(linvoke_post(linvoke, 1, &payload, sizeof(payload)), LINVOKE_POST_QUEUED);
+
+    expect_function_calls(mock_slot_with_posted_payload, 2);
+    assert_int_equal(linvoke_dispatch(linvoke), 2);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_post_queue_full_with_drop_oldest(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 7;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot_with_posted_payload);
+    linvoke_set_signal_queue_limit(linvoke, signal_id, 4, LINVOKE_OVERFLOW_DROP_OLDEST);
+
+    // Four of these events fill the 64 KiB post queue and the limit of the signal at the same time
+    static uint32_t payload[4000];
+    posted_payload_sum = 0;
+
+    for (uint32_t i = 1; i <= 4; ++i)
+    {
+        payload[0] = i;
+        assert_int_equal(linvoke_post(linvoke, signal_id, payload, sizeof(payload)), LINVOKE_POST_QUEUED);
+    }
+
+    // The new event does not fit, so it is dropped without dropping the oldest one for it
+    payload[0] = 5;
+    assert_int_equal(linvoke_post(linvoke, signal_id, payload, sizeof(payload)), LINVOKE_POST_DROPPED);
+
+    expect_function_calls(mock_slot_with_posted_payload, 4);
+    assert_int_equal(linvoke_dispatch(linvoke), 4);
+    assert_int_equal(posted_payload_sum, 1 + 2 + 3 + 4);
+
+    // The drop counts for the post queue and for the signal
+    linvoke_queue_stats_s stats;
+    linvoke_get_queue_stats(linvoke, &stats);
+    assert_int_equal(stats.dropped_newest_count, 1);
+
+    linvoke_get_signal_queue_stats(linvoke, signal_id, &stats);
+    assert_int_equal(stats.dropped_newest_count, 1);
+    assert_int_equal(stats.dropped_oldest_count, 0);
+
+    linvoke_destroy(linvoke);
+}
+
+static void *post_blocking_events(void *argument)
+{
+    linvoke_s *linvoke = argument;
+
+    for (uint32_t i = 1; i <= 5; ++i)
+    {
+        assert_int_equal(linvoke_post(linvoke, 7, &i, sizeof(i)), LINVOKE_POST_QUEUED);
+    }
+
+    return NULL;
+}
+
+static void test_post_queue_limit_block(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 7;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot_with_posted_payload);
+    linvoke_set_queue_limit(linvoke, 2, LINVOKE_OVERFLOW_BLOCK);
+
+    posted_payload_sum = 0;
+
+    pthread_t producer;
+    assert_int_equal(pthread_create(&producer, NULL, post_blocking_events, linvoke), 0);
+
+    // The producer can only post two events per dispatch, so it has to wait for the dispatches in between
+    const struct timespec delay = { .tv_sec = 0, .tv_nsec = 1000000 };
+    uint32_t dispatched_event_count = 0;
+
+    expect_function_calls(mock_slot_with_posted_payload, 5);
+
+    while (dispatched_event_count < 5)
+    {
+        nanosleep(&delay, NULL);
+        dispatched_event_count += linvoke_dispatch(linvoke);
+    }
+
+    pthread_join(producer, NULL);
+
+    // Every event was delivered, none was dropped
+    assert_int_equal(posted_payload_sum, 1 + 2 + 3 + 4 + 5);
+
+    linvoke_queue_stats_s stats;
+    linvoke_get_queue_stats(linvoke, &stats);
+    assert_int_equal(stats.dropped_newest_count, 0);
+    assert_true(stats.blocked_count >= 1);
+    assert_true(stats.blocked_nanoseconds > 0);
+
+    linvoke_destroy(linvoke);
+}
+
+static uint32_t count_report_lines(linvoke_s *linvoke, const uint32_t top_n, unsigned long *sample_count, unsigned long *estimated_call_count)
+{
+    char *report;
+    size_t report_size;
+    FILE *stream = open_memstream(&report, &report_size);
+
+    linvoke_profile_report(linvoke, stream, top_n);
+    fclose(stream);
+
+    uint32_t line_count = 0;
+
+    for (const char *character = report; *character != '\0'; ++character)
+    {
+        line_count += *character == '\n';
+    }
+
+    // The first line after the header holds the numbers of the slowest slot function
+    const char *line = strchr(report, '\n');
+
+    if (sample_count != NULL && line != NULL)
+    {
+        assert_int_equal(sscanf(line + 1, "%*s %lu %lu", sample_count, estimated_call_count), 2);
+    }
+
+    free(report);
+
+    return line_count;
+}
+
+static void test_priority_lanes_and_budget(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal low_signal_id = 1;
+    const linvoke_signal high_signal_id = 2;
+    linvoke_register_signal(linvoke, low_signal_id);
+    linvoke_register_signal(linvoke, high_signal_id);
+    linvoke_connect(linvoke, low_signal_id, mock_slot_recording_order);
+    linvoke_connect(linvoke, high_signal_id, mock_slot_recording_order);
+    linvoke_set_priority(linvoke, high_signal_id, 3);
+
+    // Priorities outside of the lanes are rejected
+    linvoke_set_priority(linvoke, low_signal_id, 100);
+
+    const int wakeup_fd = linvoke_get_fd(linvoke);
+    dispatched_signal_count = 0;
+
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+        linvoke_post(linvoke, low_signal_id, NULL, 0);
+    }
+
+    linvoke_post(linvoke, high_signal_id, NULL, 0);
+
+    // The high priority event was posted last, but is dispatched first
+    assert_int_equal(linvoke_dispatch_with_budget(linvoke, 1, 0), 1);
+    assert_int_equal(dispatched_signal_ids[0], high_signal_id);
+
+    // The eventfd stays readable while events are left
+    struct pollfd poll_fd = { .fd = wakeup_fd, .events = POLLIN };
+    assert_int_equal(poll(&poll_fd, 1, 0), 1);
+
+    assert_int_equal(linvoke_dispatch_with_budget(linvoke, 2, 0), 2);
+    assert_int_equal(linvoke_dispatch_with_budget(linvoke, 0, 1000000000u), 3);
+    assert_int_equal(dispatched_signal_count, 6);
+
+    for (uint32_t i = 1; i < 6; ++i)
+    {
+        assert_int_equal(dispatched_signal_ids[i], low_signal_id);
+    }
+
+    assert_int_equal(poll(&poll_fd, 1, 0), 0);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_priority_lanes_no_starvation(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal low_signal_id = 1;
+    const linvoke_signal high_signal_id = 2;
+    linvoke_register_signal(linvoke, low_signal_id);
+    linvoke_register_signal(linvoke, high_signal_id);
+    linvoke_connect(linvoke, low_signal_id, mock_slot_recording_order);
+    linvoke_connect(linvoke, high_signal_id, mock_slot_recording_order);
+    linvoke_set_priority(linvoke, high_signal_id, 1);
+
+    dispatched_signal_count = 0;
+    linvoke_post(linvoke, low_signal_id, NULL, 0);
+
+    // The high lane never runs empty and fills the whole budget of every dispatch,
+    // yet the low priority event is dispatched after a few dispatches
+    bool low_event_dispatched = false;
+
+    for (uint32_t dispatch = 0; dispatch < 10 && !low_event_dispatched; ++dispatch)
+    {
+        linvoke_post(linvoke, high_signal_id, NULL, 0);
+        linvoke_post(linvoke, high_signal_id, NULL, 0);
+
+        const uint32_t first_index = dispatched_signal_count;
+        assert_int_equal(linvoke_dispatch_with_budget(linvoke, 2, 0), 2);
+
+        low_event_dispatched = dispatched_signal_ids[first_index] == low_signal_id || dispatched_signal_ids[first_index + 1] == low_signal_id;
+    }
+
+    assert_true(low_event_dispatched);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_profile_report(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 7;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot1);
+    linvoke_connect(linvoke, signal_id, mock_slot2);
+
+    // Every second event is sampled
+    linvoke_set_profile_rate(linvoke, 2);
+
+    expect_function_calls(mock_slot1, 10);
+    expect_function_calls(mock_slot2, 10);
+
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        linvoke_emit(linvoke, signal_id, NULL);
+    }
+
+    // A header and one line for each slot function, which were both sampled five times
+    unsigned long sample_count = 0;
+    unsigned long estimated_call_count = 0;
+    assert_int_equal(count_report_lines(linvoke, 0, &sample_count, &estimated_call_count), 3);
+    assert_int_equal(sample_count, 5);
+    assert_int_equal(estimated_call_count, 10);
+
+    // Only the slowest slot function is printed
+    assert_int_equal(count_report_lines(linvoke, 1, NULL, NULL), 2);
+
+    // Changing the rate restarts the countdown, and every sample keeps standing for the calls of its own rate
+    linvoke_set_profile_rate(linvoke, 5);
+
+    expect_function_calls(mock_slot1, 10);
+    expect_function_calls(mock_slot2, 10);
+
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        linvoke_emit(linvoke, signal_id, NULL);
+    }
+
+    linvoke_set_profile_rate(linvoke, 0);
+
+    assert_int_equal(count_report_lines(linvoke, 0, &sample_count, &estimated_call_count), 3);
+    assert_int_equal(sample_count, 5 + 2);
+    assert_int_equal(estimated_call_count, 10 + 10);
+
+    // Without sampling, and after a reset, there is nothing to report
+    linvoke_profile_reset(linvoke);
+
+    expect_function_calls(mock_slot1, 1);
+    expect_function_calls(mock_slot2, 1);
+    linvoke_emit(linvoke, signal_id, NULL);
+
+    assert_int_equal(count_report_lines(linvoke, 0, NULL, NULL), 1);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_named_signals(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal start_id = linvoke_register_named(linvoke, "plugin.start");
+    const linvoke_signal stop_id = linvoke_register_named(linvoke, "plugin.stop");
+
+    // Named signals get their own IDs, which can be used like any other
+    assert_true(start_id >= LINVOKE_NAMED_SIGNAL_ID_BASE);
+    assert_true(stop_id >= LINVOKE_NAMED_SIGNAL_ID_BASE);
+    assert_int_not_equal(start_id, stop_id);
+    assert_int_equal(linvoke_find_named(linvoke, "plugin.start"), start_id);
+    assert_int_equal(linvoke_find_named(linvoke, "plugin.stop"), stop_id);
+    assert_int_equal(linvoke_find_named(linvoke, "plugin.restart"), LINVOKE_NO_SIGNAL);
+
+    // Registering a name again does not register another signal
+    assert_int_equal(linvoke_register_named(linvoke, "plugin.start"), start_id);
+    assert_int_equal(linvoke_get_registered_signal_count(linvoke), 2);
+
+    uint32_t start_counter = 0;
+    uint32_t stop_counter = 0;
+    linvoke_connect_with_context(linvoke, start_id, mock_slot_with_context, &start_counter);
+    linvoke_connect_with_context(linvoke, stop_id, mock_slot_with_context, &stop_counter);
+
+    static linvoke_named_signal_s start_signal = LINVOKE_NAMED_SIGNAL("plugin.start");
+    static linvoke_named_signal_s unknown_signal = LINVOKE_NAMED_SIGNAL("plugin.restart");
+
+    expect_function_calls(mock_slot_with_context, 3);
+    linvoke_emit_named(linvoke, &start_signal, NULL);
+    linvoke_emit_named(linvoke, &start_signal, NULL);
+    linvoke_emit_named(linvoke, &unknown_signal, NULL);
+    linvoke_emit(linvoke, stop_id, NULL);
+
+    assert_int_equal(start_counter, 2);
+    assert_int_equal(stop_counter, 1);
+    assert_int_equal(start_signal.signal_id, start_id);
+
+    // The name keeps its ID when its signal is unregistered and registered again,
+    // and integer IDs can not take it in the meantime
+    linvoke_unregister_signal(linvoke, start_id);
+    linvoke_register_signal(linvoke, start_id);
+    assert_int_equal(linvoke_get_registered_signal_count(linvoke), 1);
+    assert_int_equal(linvoke_register_named(linvoke, "plugin.start"), start_id);
+    assert_int_equal(linvoke_get_registered_signal_count(linvoke), 2);
+
+    // A named signal that was resolved in one linvoke object is resolved again in another
+    linvoke_s *other_linvoke = linvoke_create();
+    linvoke_register_named(other_linvoke, "plugin.other");
+    const linvoke_signal other_start_id = linvoke_register_named(other_linvoke, "plugin.start");
+    assert_int_not_equal(other_start_id, start_id);
+
+    uint32_t other_start_counter = 0;
+    linvoke_connect_with_context(other_linvoke, other_start_id, mock_slot_with_context, &other_start_counter);
+
+    expect_function_calls(mock_slot_with_context, 1);
+    linvoke_emit_named(other_linvoke, &start_signal, NULL);
+    assert_int_equal(other_start_counter, 1);
+    assert_int_equal(start_signal.signal_id, other_start_id);
+
+    linvoke_destroy(other_linvoke);
+    linvoke_destroy(linvoke);
+}
+
+static void test_keyed_signals(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 5;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot1);
+
+    // Enough keys to make the hash table grow a few times
+    uint32_t counters[1000] = { 0 };
+
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        linvoke_connect_keyed_with_context(linvoke, signal_id, 100 + i, mock_slot_with_context, &counters[i]);
+    }
+
+    uint32_t second_counter = 0;
+    assert_true(linvoke_connect_keyed_with_context(linvoke, signal_id, 600, mock_slot_with_context, &second_counter));
+
+    // This connect call will not work, because the slot is already connected for the key
+    assert_false(linvoke_connect_keyed_with_context(linvoke, signal_id, 600, mock_slot_with_context, &second_counter));
+
+    assert_int_equal(linvoke_get_keyed_slot_count(linvoke, signal_id, 600), 2);
+    assert_int_equal(linvoke_get_keyed_slot_count(linvoke, signal_id, 99), 0);
+    assert_int_equal(linvoke_get_slot_count(linvoke, signal_id), 1);
+
+    // The unkeyed slot and the slots of the key are called
+    expect_function_calls(mock_slot1, 1);
+    expect_function_calls(mock_slot_with_context, 2);
+    linvoke_emit_keyed(linvoke, signal_id, 600, NULL);
+
+    assert_int_equal(counters[500], 1);
+    assert_int_equal(second_counter, 1);
+
+    // Emitting without a key, or with a key without slots, only calls the unkeyed slot
+    expect_function_calls(mock_slot1, 2);
+    linvoke_emit(linvoke, signal_id, NULL);
+    linvoke_emit_keyed(linvoke, signal_id, 99, NULL);
+
+    linvoke_disconnect_keyed_with_context(linvoke, signal_id, 600, mock_slot_with_context, &counters[500]);
+
+    // This disconnect call will not work, because the slot is not connected for the key anymore
+    linvoke_disconnect_keyed_with_context(linvoke, signal_id, 600, mock_slot_with_context, &counters[500]);
+
+    for (uint32_t i = 0; i < 1000; i += 2)
+    {
+        linvoke_disconnect_keyed_with_context(linvoke, signal_id, 100 + i, mock_slot_with_context, &counters[i]);
+    }
+
+    // Compacting drops the keys without slots, but keeps the other keys reachable
+    linvoke_compact(linvoke);
+
+    assert_int_equal(linvoke_get_keyed_slot_count(linvoke, signal_id, 600), 1);
+    assert_int_equal(linvoke_get_keyed_slot_count(linvoke, signal_id, 100), 0);
+    assert_int_equal(linvoke_get_keyed_slot_count(linvoke, signal_id, 1099), 1);
+
+    expect_function_calls(mock_slot1, 2);
+    expect_function_calls(mock_slot_with_context, 2);
+    linvoke_emit_keyed(linvoke, signal_id, 600, NULL);
+    linvoke_emit_keyed(linvoke, signal_id, 1099, NULL);
+
+    assert_int_equal(counters[500], 1);
+    assert_int_equal(second_counter, 2);
+    assert_int_equal(counters[999], 1);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_timers(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal once_signal_id = 3;
+    const linvoke_signal periodic_signal_id = 4;
+    linvoke_register_signal(linvoke, once_signal_id);
+    linvoke_register_signal(linvoke, periodic_signal_id);
+
+    uint32_t once_counter = 0;
+    uint32_t periodic_counter = 0;
+    linvoke_connect_with_context(linvoke, once_signal_id, mock_slot_with_context, &once_counter);
+    linvoke_connect_with_context(linvoke, periodic_signal_id, mock_slot_with_context, &periodic_counter);
+
+    const linvoke_timer once_timer = linvoke_emit_after(linvoke, once_signal_id, NULL, 10);
+    const linvoke_timer cancelled_timer = linvoke_emit_after(linvoke, once_signal_id, NULL, 20);
+    const linvoke_timer periodic_timer = linvoke_emit_every(linvoke, periodic_signal_id, NULL, 7);
+
+    assert_int_not_equal(once_timer, LINVOKE_NO_TIMER);
+    assert_int_not_equal(periodic_timer, LINVOKE_NO_TIMER);
+    assert_int_equal(linvoke_emit_every(linvoke, periodic_signal_id, NULL, 0), LINVOKE_NO_TIMER);
+
+    // Nothing expires before its time
+    assert_int_equal(linvoke_advance_time(linvoke, 6), 0);
+    assert_int_equal(linvoke_get_time(linvoke), 6);
+
+    assert_true(linvoke_cancel_timer(linvoke, cancelled_timer));
+    assert_false(linvoke_cancel_timer(linvoke, cancelled_timer));
+
+    // The periodic timer expires at 7, 14, ..., 98 and the one-shot timer at 10
+    expect_function_calls(mock_slot_with_context, 15);
+    assert_int_equal(linvoke_advance_time(linvoke, 100), 15);
+    assert_int_equal(once_counter, 1);
+    assert_int_equal(periodic_counter, 14);
+
+    // Going back in time does nothing
+    assert_int_equal(linvoke_advance_time(linvoke, 50), 0);
+    assert_int_equal(linvoke_get_time(linvoke), 100);
+
+    // An expired timer can not be cancelled, a periodic one until it is cancelled
+    assert_false(linvoke_cancel_timer(linvoke, once_timer));
+    assert_true(linvoke_cancel_timer(linvoke, periodic_timer));
+    assert_int_equal(linvoke_advance_time(linvoke, 1000), 0);
+
+    // Timers far apart land on different levels of the wheel and beyond it, and still expire in order
+    const linvoke_signal order_signal_ids[] = { 10, 11, 12, 13 };
+    const uint64_t order_delays[] = { 5000, 300000, 1ull << 40, 1ull << 40 };
+
+    dispatched_signal_count = 0;
+
+    for (uint32_t i = 4; i-- > 0;)
+    {
+        linvoke_register_signal(linvoke, order_signal_ids[i]);
+        linvoke_connect(linvoke, order_signal_ids[i], mock_slot_recording_order);
+    }
+
+    // The timers with the same expiry expire in the order they were scheduled
+    linvoke_emit_after(linvoke, order_signal_ids[2], NULL, order_delays[2]);
+    linvoke_emit_after(linvoke, order_signal_ids[3], NULL, order_delays[3]);
+    linvoke_emit_after(linvoke, order_signal_ids[1], NULL, order_delays[1]);
+    linvoke_emit_after(linvoke, order_signal_ids[0], NULL, order_delays[0]);
+
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        assert_int_equal(linvoke_advance_time(linvoke, 1000 + order_delays[i] - 1), 0);
+        assert_int_equal(linvoke_advance_time(linvoke, 1000 + order_delays[i]), i < 2 ? 1 : i == 2 ? 2 : 0);
+    }
+
+    assert_int_equal(dispatched_signal_count, 4);
+
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        assert_int_equal(dispatched_signal_ids[i], order_signal_ids[i]);
+    }
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_timers_expire_on_time(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 20;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect_with_context(linvoke, signal_id, mock_slot_checking_expiry, linvoke);
+
+    // Timers with delays of every magnitude, checked against the time at which they expire.
+    // The delays and steps come from a fixed linear congruential generator, so the test is deterministic
+    static uint64_t expiries[2000];
+    uint64_t random = 12345;
+    uint32_t expired_timer_count = 0;
+
+    timer_expiry_mismatch_count = 0;
+
+    for (uint32_t i = 0; i < 2000; ++i)
+    {
+        random = random * 6364136223846793005ull + 1442695040888963407ull;
+        const uint64_t delay = 1 + ((random >> 24) & ((1ull << (random >> 58)) - 1));
+
+        expiries[i] = linvoke_get_time(linvoke) + delay;
+        linvoke_emit_after(linvoke, signal_id, &expiries[i], delay);
+
+        // Advance the time now and then, with steps of every magnitude as well
+        if (i % 4 == 0)
+        {
+            random = random * 6364136223846793005ull + 1442695040888963407ull;
+            expired_timer_count += linvoke_advance_time(linvoke, linvoke_get_time(linvoke) + ((random >> 24) & ((1ull << (random >> 59)) - 1)));
+        }
+    }
+
+    expired_timer_count += linvoke_advance_time(linvoke, UINT64_MAX - 1);
+
+    assert_int_equal(expired_timer_count, 2000);
+    assert_int_equal(timer_expiry_mismatch_count, 0);
+
+    for (uint32_t i = 0; i < 2000; ++i)
+    {
+        assert_int_equal(expiries[i], UINT64_MAX);
+    }
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_timers_far_in_the_future(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 21;
+    linvoke_register_signal(linvoke, signal_id);
+
+    uint32_t counter = 0;
+    linvoke_connect_with_context(linvoke, signal_id, mock_slot_with_context, &counter);
+
+    // Both timers are far beyond the levels of the wheel, the second one at the end of time
+    linvoke_emit_after(linvoke, signal_id, NULL, 1ull << 62);
+    linvoke_emit_after(linvoke, signal_id, NULL, UINT64_MAX);
+
+    // Cancelling the earliest timer leaves an empty block on the way, which must not lose the later timers
+    assert_true(linvoke_cancel_timer(linvoke, linvoke_emit_after(linvoke, signal_id, NULL, 1ull << 61)));
+
+    // The time jumps straight to the timers, instead of visiting every block of the top level on the way
+    struct timespec start;
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    assert_int_equal(linvoke_advance_time(linvoke, (1ull << 62) - 1), 0);
+
+    expect_function_calls(mock_slot_with_context, 2);
+    assert_int_equal(linvoke_advance_time(linvoke, 1ull << 62), 1);
+    assert_int_equal(linvoke_advance_time(linvoke, UINT64_MAX), 1);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    const int64_t elapsed = (int64_t) (end.tv_sec - start.tv_sec) * 1000000000 + (end.tv_nsec - start.tv_nsec);
+    assert_true(elapsed < 100000000);
+    assert_int_equal(counter, 2);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_parallel_emit(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal large_signal_id = 1;
+    const linvoke_signal small_signal_id = 2;
+    linvoke_register_signal(linvoke, large_signal_id);
+    linvoke_register_signal(linvoke, small_signal_id);
+
+    uint32_t large_counters[1000] = { 0 };
+    uint32_t small_counters[4] = { 0 };
+
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        linvoke_connect_with_context(linvoke, large_signal_id, mock_slot_with_thread_counter, &large_counters[i]);
+    }
+
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        linvoke_connect_with_context(linvoke, small_signal_id, mock_slot_with_thread_counter, &small_counters[i]);
+    }
+
+    // A disconnected slot must be skipped by whichever thread reaches it
+    linvoke_disconnect_with_context(linvoke, large_signal_id, mock_slot_with_thread_counter, &large_counters[500]);
+
+    linvoke_set_parallel(linvoke, large_signal_id, true);
+    linvoke_set_parallel(linvoke, small_signal_id, true);
+
+    for (uint32_t round = 0; round < 100; ++round)
+    {
+        linvoke_emit(linvoke, large_signal_id, NULL);
+        linvoke_emit(linvoke, small_signal_id, NULL);
+    }
+
+    // Every slot should have been called exactly once per emitted event, by whichever thread took it
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        assert_int_equal(large_counters[i], i == 500 ? 0 : 100);
+    }
+
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        assert_int_equal(small_counters[i], 100);
+    }
+
+    // Turning the flag off emits inline again
+    linvoke_set_parallel(linvoke, large_signal_id, false);
+    linvoke_emit(linvoke, large_signal_id, NULL);
+    assert_int_equal(large_counters[0], 101);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_record_and_replay(void **state)
+{
+    (void) state; // unused
+
+    char path[] = "/tmp/linvoke-test-XXXXXX";
+    close(mkstemp(path));
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 7;
+    const linvoke_signal unconnected_signal_id = 8;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_register_signal(linvoke, unconnected_signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot_with_posted_payload);
+    linvoke_record_payload(linvoke, signal_id, sizeof(uint32_t));
+
+    assert_true(linvoke_record_start(linvoke, path));
+
+    posted_payload_sum = 0;
+    expect_function_calls(mock_slot_with_posted_payload, 3);
+
+    for (uint32_t i = 1; i <= 3; ++i)
+    {
+        linvoke_emit(linvoke, signal_id, &i);
+    }
+
+    // Enough events without a payload to make the log outgrow its initial mapping
+    for (uint32_t i = 0; i < 100000; ++i)
+    {
+        linvoke_emit(linvoke, unconnected_signal_id, NULL);
+    }
+
+    linvoke_record_stop(linvoke);
+
+    // Events that are emitted after the recording stopped are not in the log
+    expect_function_calls(mock_slot_with_posted_payload, 1);
+    uint32_t value = 100;
+    linvoke_emit(linvoke, signal_id, &value);
+
+    // The replayed events carry the recorded payloads
+    posted_payload_sum = 0;
+    expect_function_calls(mock_slot_with_posted_payload, 3);
+    assert_int_equal(linvoke_replay(linvoke, path, 0), 3 + 100000);
+    assert_int_equal(posted_payload_sum, 1 + 2 + 3);
+
+    linvoke_destroy(linvoke);
+    unlink(path);
+}
+
+static void test_record_parallel_emit(void **state)
+{
+    (void) state; // unused
+
+    char path[] = "/tmp/linvoke-test-XXXXXX";
+    close(mkstemp(path));
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal parallel_signal_id = 1;
+    const linvoke_signal nested_signal_id = 2;
+    linvoke_register_signal(linvoke, parallel_signal_id);
+    linvoke_register_signal(linvoke, nested_signal_id);
+    linvoke_record_payload(linvoke, nested_signal_id, sizeof(uint32_t));
+
+    // Every slot of the parallel signal emits a nested event, so the worker threads record at the same time.
+    // The slots need different contexts to be connected more than once, so each gets its own pointer to the linvoke object
+    linvoke_s *contexts[1000];
+
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        contexts[i] = linvoke;
+        linvoke_connect_with_context(linvoke, parallel_signal_id, mock_slot_emitting_from_thread, &contexts[i]);
+    }
+
+    linvoke_set_parallel(linvoke, parallel_signal_id, true);
+
+    assert_true(linvoke_record_start(linvoke, path));
+
+    for (uint32_t round = 0; round < 100; ++round)
+    {
+        linvoke_emit(linvoke, parallel_signal_id, NULL);
+    }
+
+    linvoke_record_stop(linvoke);
+
+    // No record was lost or torn by the concurrent appends
+    assert_int_equal(linvoke_replay(linvoke, path, 0), 100 + 100 * 1000);
+
+    linvoke_destroy(linvoke);
+    unlink(path);
+}
+
+static void test_replay_unclosed_log(void **state)
+{
+    (void) state; // unused
+
+    char path[] = "/tmp/linvoke-test-XXXXXX";
+    close(mkstemp(path));
+
+    const linvoke_signal signal_id = 7;
+
+    // The child process dies while recording, so the log is never trimmed and ends with the zeros of its unused space
+    const pid_t pid = fork();
+    assert_true(pid >= 0);
+
+    if (pid == 0)
+    {
+        linvoke_s *child = linvoke_create();
+        linvoke_register_signal(child, signal_id);
+        linvoke_record_payload(child, signal_id, sizeof(uint32_t));
+        linvoke_record_start(child, path);
+
+        for (uint32_t i = 1; i <= 2; ++i)
+        {
+            linvoke_emit(child, signal_id, &i);
+        }
+
+        _exit(0);
+    }
+
+    int status;
+    assert_int_equal(waitpid(pid, &status, 0), pid);
+    assert_true(WIFEXITED(status));
+
+    linvoke_s *linvoke = linvoke_create();
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot_with_posted_payload);
+
+    // Only the two committed events are replayed
+    posted_payload_sum = 0;
+    expect_function_calls(mock_slot_with_posted_payload, 2);
+    assert_int_equal(linvoke_replay(linvoke, path, 0), 2);
+    assert_int_equal(posted_payload_sum, 1 + 2);
+
+    linvoke_destroy(linvoke);
+    unlink(path);
+}
+
+static void test_replay_original_timing(void **state)
+{
+    (void) state; // unused
+
+    char path[] = "/tmp/linvoke-test-XXXXXX";
+    close(mkstemp(path));
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 8;
+    linvoke_register_signal(linvoke, signal_id);
+
+    // Record two events 40 milliseconds apart
+    const struct timespec delay = { .tv_sec = 0, .tv_nsec = 40000000 };
+    linvoke_record_start(linvoke, path);
+    linvoke_emit(linvoke, signal_id, NULL);
+    nanosleep(&delay, NULL);
+    linvoke_emit(linvoke, signal_id, NULL);
+    linvoke_record_stop(linvoke);
+
+    // At twice the speed the replay takes at least half of the original time
+    struct timespec start;
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    assert_int_equal(linvoke_replay(linvoke, path, 2.0), 2);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    const int64_t elapsed = (int64_t) (end.tv_sec - start.tv_sec) * 1000000000 + (end.tv_nsec - start.tv_nsec);
+    assert_true(elapsed >= 20000000);
+
+    linvoke_destroy(linvoke);
+    unlink(path);
+}
+
+static void test_bridge_reserve_and_dispatch(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *linvoke = linvoke_create();
+
+    const linvoke_signal signal_id = 7;
+    linvoke_register_signal(linvoke, signal_id);
+    linvoke_connect(linvoke, signal_id, mock_slot_with_posted_payload);
+
+    // The size of a bridge has to be a power of two
+    assert_null(linvoke_bridge_create(1000));
+
+    linvoke_bridge_s *bridge = linvoke_bridge_create(4096);
+    assert_non_null(bridge);
+
+    // A second mapping of the same memfd sees the events of the first one
+    linvoke_bridge_s *opened_bridge = linvoke_bridge_open(linvoke_bridge_get_fd(bridge));
+    assert_non_null(opened_bridge);
+
+    // Nothing was committed yet, so the wait should time out
+    assert_int_equal(linvoke_bridge_wait(bridge, 0), 0);
+
+    posted_payload_sum = 0;
+
+    for (uint32_t i = 1; i <= 3; ++i)
+    {
+        uint32_t *payload = linvoke_bridge_reserve(opened_bridge, signal_id, sizeof(*payload));
+        assert_non_null(payload);
+        *payload = i;
+        linvoke_bridge_commit(opened_bridge, payload);
+    }
+
+    assert_int_equal(linvoke_bridge_wait(bridge, 0), 1);
+
+    expect_function_calls(mock_slot_with_posted_payload, 3);
+    assert_int_equal(linvoke_bridge_dispatch(bridge, linvoke), 3);
+    assert_int_equal(posted_payload_sum, 1 + 2 + 3);
+
+    assert_int_equal(linvoke_bridge_wait(bridge, 0), 0);
+    assert_int_equal(linvoke_bridge_dispatch(bridge, linvoke), 0);
+
+    linvoke_bridge_destroy(opened_bridge);
+    linvoke_bridge_destroy(bridge);
+    linvoke_destroy(linvoke);
+}
+
+static void test_bridge_forward_across_processes(void **state)
+{
+    (void) state; // unused
+
+    const linvoke_signal signal_id = 7;
+    const uint32_t event_count = 1000;
+
+    // The bridge is much smaller than all the events together, so the sender has to wait for space
+    linvoke_bridge_s *bridge = linvoke_bridge_create(1024);
+    assert_non_null(bridge);
+
+    const pid_t pid = fork();
+    assert_true(pid >= 0);
+
+    if (pid == 0)
+    {
+        // The sending process emits the events on its own linvoke object
+        linvoke_s *sender = linvoke_create();
+        linvoke_register_signal(sender, signal_id);
+        linvoke_bridge_forward(sender, signal_id, bridge, sizeof(uint32_t));
+
+        for (uint32_t i = 1; i <= event_count; ++i)
+        {
+            linvoke_emit(sender, signal_id, &i);
+        }
+
+        linvoke_destroy(sender);
+        linvoke_bridge_destroy(bridge);
+        _exit(0);
+    }
+
+    linvoke_s *receiver = linvoke_create();
+    linvoke_register_signal(receiver, signal_id);
+    linvoke_connect(receiver, signal_id, mock_slot_with_posted_payload);
+
+    posted_payload_sum = 0;
+    expect_function_calls(mock_slot_with_posted_payload, event_count);
+
+    uint32_t received_event_count = 0;
+
+    while (received_event_count < event_count && linvoke_bridge_wait(bridge, 5000) == 1)
+    {
+        received_event_count += linvoke_bridge_dispatch(bridge, receiver);
+    }
+
+    int status;
+    assert_int_equal(waitpid(pid, &status, 0), pid);
+    assert_true(WIFEXITED(status));
+    assert_int_equal(WEXITSTATUS(status), 0);
+
+    // Every event should arrive exactly once and in order
+    assert_int_equal(received_event_count, event_count);
+    assert_int_equal(posted_payload_sum, event_count * (event_count + 1) / 2);
+
+    linvoke_bridge_destroy(bridge);
+    linvoke_destroy(receiver);
+}
+
 int main(void)
 {
     const struct CMUnitTest tests[] = {
@@ -531,6 +2229,40 @@ int main(void)
         cmocka_unit_test(test_multiple_signals_different_id_one_slot),
         cmocka_unit_test(test_multiple_signals_different_id_multiple_same_slot),
         cmocka_unit_test(test_multiple_signals_different_id_multiple_different_slot),
+        cmocka_unit_test(test_register_signals),
+        cmocka_unit_test(test_connect_many),
+        cmocka_unit_test(test_one_signal_many_slots),
+        cmocka_unit_test(test_disconnect),
+        cmocka_unit_test(test_disconnect_many_slots),
+        cmocka_unit_test(test_reconnect_keeps_order),
+        cmocka_unit_test(test_unregister_signal),
+        cmocka_unit_test(test_unregister_signal_from_slot),
+        cmocka_unit_test(test_connect_with_context),
+        cmocka_unit_test(test_post_and_dispatch),
+        cmocka_unit_test(test_post_reserve_uncommitted),
+        cmocka_unit_test(test_post_queue_reuses_space),
+        cmocka_unit_test(test_post_queue_alternating_large_events),
+        cmocka_unit_test(test_post_wakeup_fd),
+        cmocka_unit_test(test_post_wakeup_fd_created_late),
+        cmocka_unit_test(test_post_queue_limit_drop_newest),
+        cmocka_unit_test(test_signal_queue_limit_drop_oldest_and_coalesce),
+        cmocka_unit_test(test_post_queue_full_with_drop_oldest),
+        cmocka_unit_test(test_post_queue_limit_block),
+        cmocka_unit_test(test_priority_lanes_and_budget),
+        cmocka_unit_test(test_priority_lanes_no_starvation),
+        cmocka_unit_test(test_profile_report),
+        cmocka_unit_test(test_named_signals),
+        cmocka_unit_test(test_keyed_signals),
+        cmocka_unit_test(test_timers),
+        cmocka_unit_test(test_timers_expire_on_time),
+        cmocka_unit_test(test_timers_far_in_the_future),
+        cmocka_unit_test(test_parallel_emit),
+        cmocka_unit_test(test_record_and_replay),
+        cmocka_unit_test(test_record_parallel_emit),
+        cmocka_unit_test(test_replay_unclosed_log),
+        cmocka_unit_test(test_replay_original_timing),
+        cmocka_unit_test(test_bridge_reserve_and_dispatch),
+        cmocka_unit_test(test_bridge_forward_across_processes),
     };
 
     return cmocka_run_group_tests(tests, NULL, NULL);
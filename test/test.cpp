@@ -0,0 +1,236 @@
+/**
+ * @file:      test.cpp
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include <linvoke.hpp>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string>
+
+/**
+ * @struct copy_counter
+ * @brief An argument that counts how many times it was copied
+ * @var copy_count The number of copies that were made of the original object
+ */
+struct copy_counter
+{
+    int *copy_count;
+
+    explicit copy_counter(int *copy_count) : copy_count(copy_count)
+    {
+    }
+
+    copy_counter(const copy_counter &other) : copy_count(other.copy_count)
+    {
+        ++*copy_count;
+    }
+};
+
+static void test_typed_signal_lambda_slots(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *lv = linvoke_create();
+
+    const linvoke_signal signal_id = 3;
+    linvoke_register_signal(lv, signal_id);
+
+    const linvoke::signal<int, const std::string &> signal(lv, signal_id);
+
+    int sum = 0;
+    std::string names;
+
+    {
+        // Two lambdas with captures, each stored inside its own connection
+        auto sum_connection = signal.connect([&sum](int value, const std::string &)
+        {
+            sum += value;
+        });
+        auto name_connection = signal.connect([&names](int, const std::string &name)
+        {
+            names += name;
+        });
+
+        // Both connections use the same linvoke signal, with different slots
+        assert_int_equal(linvoke_get_slot_count(lv, signal_id), 2);
+
+        signal.emit(2, "a");
+        signal.emit(3, "b");
+
+        assert_int_equal(sum, 5);
+        assert_string_equal(names.c_str(), "ab");
+    }
+
+    // The connections were destroyed, so the slots should be disconnected
+    assert_int_equal(linvoke_get_slot_count(lv, signal_id), 0);
+
+    signal.emit(4, "c");
+
+    assert_int_equal(sum, 5);
+    assert_string_equal(names.c_str(), "ab");
+
+    linvoke_destroy(lv);
+}
+
+static void test_typed_signal_same_lambda_type(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *lv = linvoke_create();
+
+    const linvoke_signal signal_id = 3;
+    linvoke_register_signal(lv, signal_id);
+
+    const linvoke::signal<int &> signal(lv, signal_id);
+
+    {
+        // Both connections hold the same lambda type, so they share the trampoline and only differ in their context
+        const auto increment = [](int &value)
+        {
+            ++value;
+        };
+        auto first_connection = signal.connect(increment);
+        auto second_connection = signal.connect(increment);
+
+        assert_int_equal(linvoke_get_slot_count(lv, signal_id), 2);
+
+        // The argument is passed by reference, so both slots increment the same value
+        int value = 0;
+        signal.emit(value);
+
+        assert_int_equal(value, 2);
+    }
+
+    // The connections have to be destroyed before the linvoke object
+    linvoke_destroy(lv);
+}
+
+static void test_typed_signal_ignores_foreign_events(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *lv = linvoke_create();
+
+    const linvoke_signal signal_id = 3;
+    linvoke_register_signal(lv, signal_id);
+
+    const linvoke::signal<int &> signal(lv, signal_id);
+    const linvoke::signal<long &> other_signal(lv, signal_id);
+
+    {
+        int event_count = 0;
+        auto connection = signal.connect([&event_count](int &)
+        {
+            ++event_count;
+        });
+
+        // Events that were not emitted through a typed handle with the same arguments do not reach the callable
+        uint64_t foreign_data = 42;
+        long other_value = 0;
+        linvoke_emit(lv, signal_id, NULL);
+        linvoke_emit(lv, signal_id, &foreign_data);
+        linvoke_emit_typed(lv, signal_id, &foreign_data, &foreign_data);
+        other_signal.emit(other_value);
+
+        assert_int_equal(event_count, 0);
+
+        int value = 0;
+        signal.emit(value);
+
+        assert_int_equal(event_count, 1);
+    }
+
+    linvoke_destroy(lv);
+}
+
+static void test_typed_signal_emits_without_copies(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *lv = linvoke_create();
+
+    const linvoke_signal signal_id = 3;
+    linvoke_register_signal(lv, signal_id);
+
+    const linvoke::signal<copy_counter, const copy_counter &> signal(lv, signal_id);
+
+    int copy_count = 0;
+    int event_count = 0;
+
+    {
+        auto connection = signal.connect([&event_count](copy_counter &, const copy_counter &)
+        {
+            ++event_count;
+        });
+
+        // Both lvalues and temporaries are passed to the slots by reference
+        copy_counter value(&copy_count);
+        signal.emit(value, value);
+        signal.emit(copy_counter(&copy_count), copy_counter(&copy_count));
+
+        assert_int_equal(event_count, 2);
+        assert_int_equal(copy_count, 0);
+
+        // A const object can not be given to the slots as a non-const argument, so only that one is copied
+        const copy_counter const_value(&copy_count);
+        signal.emit(const_value, const_value);
+
+        assert_int_equal(event_count, 3);
+        assert_int_equal(copy_count, 1);
+    }
+
+    linvoke_destroy(lv);
+}
+
+static void test_typed_signal_failed_connection(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *lv = linvoke_create();
+
+    const linvoke_signal signal_id = 3;
+    const linvoke::signal<int> signal(lv, signal_id);
+
+    int event_count = 0;
+
+    {
+        // The signal is not registered, so the callable can not be connected
+        auto connection = signal.connect([&event_count](int)
+        {
+            ++event_count;
+        });
+
+        assert_false(static_cast<bool>(connection));
+
+        linvoke_register_signal(lv, signal_id);
+        signal.emit(1);
+
+        assert_int_equal(event_count, 0);
+        assert_int_equal(linvoke_get_slot_count(lv, signal_id), 0);
+    }
+
+    linvoke_destroy(lv);
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_typed_signal_lambda_slots),
+        cmocka_unit_test(test_typed_signal_same_lambda_type),
+        cmocka_unit_test(test_typed_signal_ignores_foreign_events),
+        cmocka_unit_test(test_typed_signal_emits_without_copies),
+        cmocka_unit_test(test_typed_signal_failed_connection),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
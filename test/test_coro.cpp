@@ -0,0 +1,180 @@
+/**
+ * @file:      test_coro.cpp
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include <linvoke_coro.hpp>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+/**
+ * @brief Waits for a number of events and adds up the integers they carry
+ */
+static linvoke::task sum_events(linvoke::signal_waiters &waiters, const int event_count, int &sum)
+{
+    for (int i = 0; i < event_count; ++i)
+    {
+        const linvoke::event event = co_await linvoke::next(waiters);
+        assert_int_equal(event.signal_id, waiters.id());
+        sum += *static_cast<int *>(event.user_data);
+    }
+}
+
+static void test_coroutine_resumed_inline(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *lv = linvoke_create();
+
+    const linvoke_signal signal_id = 3;
+    linvoke_register_signal(lv, signal_id);
+
+    {
+        linvoke::signal_waiters waiters(lv, signal_id);
+
+        int first_sum = 0;
+        int second_sum = 0;
+        const linvoke::task first = sum_events(waiters, 2, first_sum);
+        const linvoke::task second = sum_events(waiters, 1, second_sum);
+
+        // Both coroutines wait on the same slot
+        assert_int_equal(linvoke_get_slot_count(lv, signal_id), 1);
+        assert_false(waiters.empty());
+
+        // Each emit resumes every waiting coroutine once, even the one that waits again while it is resumed
+        int value = 2;
+        linvoke_emit(lv, signal_id, &value);
+
+        assert_int_equal(first_sum, 2);
+        assert_int_equal(second_sum, 2);
+        assert_false(first.done());
+        assert_true(second.done());
+
+        value = 5;
+        linvoke_emit(lv, signal_id, &value);
+
+        assert_int_equal(first_sum, 7);
+        assert_int_equal(second_sum, 2);
+        assert_true(first.done());
+        assert_true(waiters.empty());
+
+        // Emitting without waiters does nothing
+        linvoke_emit(lv, signal_id, &value);
+    }
+
+    // The waiters were destroyed, so the slot should be disconnected
+    assert_int_equal(linvoke_get_slot_count(lv, signal_id), 0);
+
+    linvoke_destroy(lv);
+}
+
+static void test_coroutine_resumed_by_executor(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *lv = linvoke_create();
+
+    const linvoke_signal signal_id = 3;
+    linvoke_register_signal(lv, signal_id);
+
+    {
+        linvoke::queued_executor executor;
+        linvoke::signal_waiters waiters(lv, signal_id, &executor);
+
+        int sum = 0;
+        const linvoke::task task = sum_events(waiters, 2, sum);
+
+        // The emitted values have to outlive the emits, because the coroutine reads them later
+        int first_value = 3;
+        int second_value = 4;
+        linvoke_emit(lv, signal_id, &first_value);
+
+        // The coroutine does not wait any more, but is not resumed until the executor runs
+        assert_true(waiters.empty());
+        assert_false(executor.empty());
+        assert_int_equal(sum, 0);
+
+        // Events emitted while the coroutine is queued are missed
+        linvoke_emit(lv, signal_id, &second_value);
+
+        assert_int_equal(executor.run(), 1);
+        assert_int_equal(sum, 3);
+        assert_true(executor.empty());
+        assert_false(waiters.empty());
+
+        linvoke_emit(lv, signal_id, &second_value);
+
+        assert_int_equal(executor.run(), 1);
+        assert_int_equal(sum, 7);
+        assert_true(task.done());
+        assert_int_equal(executor.run(), 0);
+    }
+
+    linvoke_destroy(lv);
+}
+
+static void test_coroutine_destroyed_while_waiting(void **state)
+{
+    (void) state; // unused
+
+    linvoke_s *lv = linvoke_create();
+
+    const linvoke_signal signal_id = 3;
+    linvoke_register_signal(lv, signal_id);
+
+    {
+        linvoke::queued_executor executor;
+        linvoke::signal_waiters inline_waiters(lv, signal_id);
+        linvoke::signal_waiters queued_waiters(lv, signal_id, &executor);
+
+        int kept_sum = 0;
+        int dropped_sum = 0;
+        const linvoke::task kept = sum_events(inline_waiters, 2, kept_sum);
+
+        {
+            // Destroying the tasks removes their coroutines from the waiters and from the executor
+            const linvoke::task dropped = sum_events(inline_waiters, 2, dropped_sum);
+            const linvoke::task queued = sum_events(queued_waiters, 2, dropped_sum);
+
+            int value = 1;
+            linvoke_emit(lv, signal_id, &value);
+
+            assert_int_equal(kept_sum, 1);
+            assert_int_equal(dropped_sum, 1);
+            assert_false(executor.empty());
+        }
+
+        assert_true(executor.empty());
+        assert_true(queued_waiters.empty());
+
+        int value = 6;
+        linvoke_emit(lv, signal_id, &value);
+
+        assert_int_equal(executor.run(), 0);
+        assert_int_equal(kept_sum, 7);
+        assert_int_equal(dropped_sum, 1);
+        assert_true(kept.done());
+    }
+
+    linvoke_destroy(lv);
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_coroutine_resumed_inline),
+        cmocka_unit_test(test_coroutine_resumed_by_executor),
+        cmocka_unit_test(test_coroutine_destroyed_while_waiting),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
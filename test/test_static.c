@@ -0,0 +1,182 @@
+/**
+ * @file:      test_static.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+// The library linked with these tests is built with the same capacities
+#define LINVOKE_MAX_SIGNALS 4
+#define LINVOKE_MAX_SLOTS_PER_SIGNAL 2
+
+#include <linvoke.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+void mock_slot_with_context(linvoke_event_s *event)
+{
+    uint32_t *counter = linvoke_event_get_context(event);
+
+    // Every connection of this slot has its own counter as the context
+    ++*counter;
+
+    function_called();
+}
+
+static void test_static_capacity(void **state)
+{
+    (void) state; // unused
+
+    static linvoke_storage_s storage;
+    linvoke_s *linvoke = linvoke_init(&storage);
+
+    for (linvoke_signal signal_id = 0; signal_id < 5; ++signal_id)
+    {
+        linvoke_register_signal(linvoke, signal_id);
+    }
+
+    // Only LINVOKE_MAX_SIGNALS signals fit, the last one is refused
+    assert_int_equal(linvoke_get_registered_signal_count(linvoke), 4);
+
+    uint32_t counters[3] = { 0 };
+
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        linvoke_connect_with_context(linvoke, 0, mock_slot_with_context, &counters[i]);
+    }
+
+    // Only LINVOKE_MAX_SLOTS_PER_SIGNAL slots fit, the last one is refused
+    assert_int_equal(linvoke_get_slot_count(linvoke, 0), 2);
+
+    expect_function_calls(mock_slot_with_context, 2);
+    linvoke_emit(linvoke, 0, NULL);
+
+    assert_int_equal(counters[0], 1);
+    assert_int_equal(counters[1], 1);
+    assert_int_equal(counters[2], 0);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_static_compact(void **state)
+{
+    (void) state; // unused
+
+    linvoke_storage_s storage;
+    linvoke_s *linvoke = linvoke_init(&storage);
+
+    for (linvoke_signal signal_id = 0; signal_id < 4; ++signal_id)
+    {
+        linvoke_register_signal(linvoke, signal_id);
+    }
+
+    uint32_t counters[4] = { 0 };
+
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        linvoke_connect_with_context(linvoke, i, mock_slot_with_context, &counters[i]);
+    }
+
+    // Unregistered signals keep their place until the linvoke object is compacted
+    linvoke_unregister_signal(linvoke, 1);
+    linvoke_register_signal(linvoke, 4);
+    assert_int_equal(linvoke_get_registered_signal_count(linvoke), 3);
+
+    linvoke_compact(linvoke);
+    linvoke_register_signal(linvoke, 4);
+    assert_int_equal(linvoke_get_registered_signal_count(linvoke), 4);
+
+    // The signals that were moved by the compaction keep their slots, and the new signal starts without any
+    assert_int_equal(linvoke_get_slot_count(linvoke, 4), 0);
+
+    expect_function_calls(mock_slot_with_context, 3);
+    linvoke_emit(linvoke, 0, NULL);
+    linvoke_emit(linvoke, 2, NULL);
+    linvoke_emit(linvoke, 3, NULL);
+    linvoke_emit(linvoke, 4, NULL);
+
+    assert_int_equal(counters[0], 1);
+    assert_int_equal(counters[1], 0);
+    assert_int_equal(counters[2], 1);
+    assert_int_equal(counters[3], 1);
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_static_reconnect_without_compact(void **state)
+{
+    (void) state; // unused
+
+    static linvoke_storage_s storage;
+    linvoke_s *linvoke = linvoke_init(&storage);
+
+    linvoke_register_signal(linvoke, 0);
+
+    uint32_t counters[10] = { 0 };
+    linvoke_connect_with_context(linvoke, 0, mock_slot_with_context, &counters[0]);
+
+    // Every slot that is connected after the first one would not fit without the space of the disconnected ones
+    for (uint32_t i = 1; i < 10; ++i)
+    {
+        linvoke_connect_with_context(linvoke, 0, mock_slot_with_context, &counters[i]);
+        assert_int_equal(linvoke_get_slot_count(linvoke, 0), 2);
+
+        expect_function_calls(mock_slot_with_context, 2);
+        linvoke_emit(linvoke, 0, NULL);
+
+        linvoke_disconnect_with_context(linvoke, 0, mock_slot_with_context, &counters[i]);
+    }
+
+    assert_int_equal(counters[0], 9);
+
+    for (uint32_t i = 1; i < 10; ++i)
+    {
+        assert_int_equal(counters[i], 1);
+    }
+
+    linvoke_destroy(linvoke);
+}
+
+static void test_static_post_and_dispatch(void **state)
+{
+    (void) state; // unused
+
+    linvoke_storage_s storage;
+    linvoke_s *linvoke = linvoke_init(&storage);
+
+    uint32_t counter = 0;
+    linvoke_register_signal(linvoke, 0);
+    linvoke_connect_with_context(linvoke, 0, mock_slot_with_context, &counter);
+
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        void *payload = linvoke_post_reserve(linvoke, 0, 16);
+        assert_non_null(payload);
+        linvoke_post_commit(linvoke, payload);
+    }
+
+    expect_function_calls(mock_slot_with_context, 3);
+    assert_int_equal(linvoke_dispatch(linvoke), 3);
+    assert_int_equal(counter, 3);
+
+    linvoke_destroy(linvoke);
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_static_capacity),
+        cmocka_unit_test(test_static_compact),
+        cmocka_unit_test(test_static_reconnect_without_compact),
+        cmocka_unit_test(test_static_post_and_dispatch),
+    };
+
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,174 @@
+/**
+ * @file:      replay.c
+ *
+ * @date:      18 October 2026
+ *
+ * @author:    Kostoski Stefan
+ *
+ * @copyright: Copyright (c) 2026 Kostoski Stefan.
+ *             This work is licensed under the terms of the MIT license.
+ *             For a copy, see <https://opensource.org/license/MIT>.
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <linvoke.h>
+
+/**
+ * @struct signal_summary_s
+ * @brief The number of events and payload bytes of one signal in the log
+ */
+typedef struct signal_summary_s
+{
+    linvoke_signal signal_id;
+    uint64_t event_count;
+    uint64_t payload_bytes;
+} signal_summary_s;
+
+/**
+ * @brief Calculates the number of bytes a record with a given payload size occupies in the log
+ */
+static uint64_t record_length(const uint32_t payload_size)
+{
+    return sizeof(linvoke_log_record_s) + (((uint64_t) payload_size + LINVOKE_LOG_ALIGNMENT - 1) & ~(uint64_t) (LINVOKE_LOG_ALIGNMENT - 1));
+}
+
+/**
+ * @brief The time at which the replay started, so every event can be printed with its offset
+ */
+static struct timespec replay_start;
+
+/**
+ * @brief Prints every replayed event with the time since the replay started
+ */
+static void print_slot(linvoke_event_s *event)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    const double offset = (double) (now.tv_sec - replay_start.tv_sec) * 1e3 + (double) (now.tv_nsec - replay_start.tv_nsec) / 1e6;
+    printf("%12.3f ms  signal %u\n", offset, linvoke_event_get_signal_id(event));
+}
+
+/**
+ * @brief Finds the summary of a signal, adding it if it is not in the array yet
+ */
+static signal_summary_s *find_summary(signal_summary_s **summaries, uint32_t *summary_count, const linvoke_signal signal_id)
+{
+    for (uint32_t i = 0; i < *summary_count; ++i)
+    {
+        if ((*summaries)[i].signal_id == signal_id)
+        {
+            return &(*summaries)[i];
+        }
+    }
+
+    signal_summary_s *reallocated_summaries = realloc(*summaries, (*summary_count + 1) * sizeof(**summaries));
+
+    if (reallocated_summaries == NULL)
+    {
+        return NULL;
+    }
+
+    *summaries = reallocated_summaries;
+    signal_summary_s *const summary = &(*summaries)[(*summary_count)++];
+    summary->signal_id = signal_id;
+    summary->event_count = 0;
+    summary->payload_bytes = 0;
+
+    return summary;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        fprintf(stderr, "Usage: %s <event log> [speed]\n", argv[0]);
+        fprintf(stderr, "Replays an event log recorded with linvoke_record_start and prints every event.\n");
+        fprintf(stderr, "A speed of 0, the default, replays as fast as possible, 1 keeps the original timing.\n");
+        return 1;
+    }
+
+    const double speed = argc == 3 ? atof(argv[2]) : 0;
+
+    // Walk the log once to find the signals that have to be registered before the replay
+    const int fd = open(argv[1], O_RDONLY);
+    struct stat status;
+
+    if (fd < 0 || fstat(fd, &status) != 0 || (size_t) status.st_size < sizeof(linvoke_log_header_s))
+    {
+        fprintf(stderr, "Failed to open the event log %s.\n", argv[1]);
+        return 1;
+    }
+
+    const uint64_t size = (uint64_t) status.st_size;
+    const uint8_t *const memory = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    const linvoke_log_header_s *const header = (const linvoke_log_header_s *) memory;
+
+    if (memory == MAP_FAILED || memcmp(header->magic, LINVOKE_LOG_MAGIC, sizeof(header->magic)) != 0 || header->length < sizeof(*header))
+    {
+        fprintf(stderr, "The file %s is not an event log.\n", argv[1]);
+        return 1;
+    }
+
+    // Only the committed records are counted, like linvoke_replay only replays those
+    const uint64_t end = header->length < size ? header->length : size;
+    signal_summary_s *summaries = NULL;
+    uint32_t summary_count = 0;
+    uint64_t position = sizeof(linvoke_log_header_s);
+
+    while (position + sizeof(linvoke_log_record_s) <= end)
+    {
+        const linvoke_log_record_s *const record = (const linvoke_log_record_s *) (memory + position);
+
+        if (position + record_length(record->payload_size) > end)
+        {
+            break;
+        }
+
+        signal_summary_s *const summary = find_summary(&summaries, &summary_count, record->signal_id);
+
+        if (summary == NULL)
+        {
+            fprintf(stderr, "Failed to allocate memory for the signal summaries.\n");
+            return 1;
+        }
+
+        ++summary->event_count;
+        summary->payload_bytes += record->payload_size;
+        position += record_length(record->payload_size);
+    }
+
+    munmap((void *) memory, size);
+
+    linvoke_s *linvoke = linvoke_create();
+
+    for (uint32_t i = 0; i < summary_count; ++i)
+    {
+        linvoke_register_signal(linvoke, summaries[i].signal_id);
+        linvoke_connect(linvoke, summaries[i].signal_id, print_slot);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &replay_start);
+    const uint32_t replayed_event_count = linvoke_replay(linvoke, argv[1], speed);
+
+    printf("\nReplayed %u events\n", replayed_event_count);
+
+    for (uint32_t i = 0; i < summary_count; ++i)
+    {
+        printf("signal %u: %lu events, %lu payload bytes\n", summaries[i].signal_id, (unsigned long) summaries[i].event_count, (unsigned long) summaries[i].payload_bytes);
+    }
+
+    linvoke_destroy(linvoke);
+    free(summaries);
+
+    return 0;
+}